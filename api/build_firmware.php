@@ -38,6 +38,83 @@ if (!$authUser) {
     exit;
 }
 
+/**
+ * GFXfonts the watch's faces render with, mirroring getFont() in
+ * firmware/include/fonts.h, each mapped to the characters it can show
+ * (null = any). Disabled faces count too (they can be re-enabled without
+ * a reflash), and calendar complications also need the bold weight for
+ * their bold-marked lines. $oblique collects the fonts of sourced
+ * complications that can go stale, which the firmware draws oblique.
+ */
+function watchFonts($watch, $facesDir, &$oblique = []) {
+    $sizes = [12 => 0, 16 => 1, 24 => 2, 48 => 3, 60 => 4, 72 => 5];
+    $names = [
+        'sans'  => ['FreeSans9pt7b', 'FreeSans12pt7b', 'FreeSans18pt7b',
+                    'FreeSans24pt7b', 'FreeSans36pt7b', 'FreeSans48pt7b'],
+        'serif' => ['FreeSerif9pt7b', 'FreeSerif12pt7b', 'FreeSerif18pt7b',
+                    'FreeSerif24pt7b', 'FreeSerif36pt7b', 'FreeSerif48pt7b'],
+        'mono'  => ['Tamzen13x1', 'Tamzen16x1', 'Tamzen26x2',
+                    'Tamzen32x2', 'Tamzen60x3', 'Tamzen80x4'],
+    ];
+    // What the firmware's local complications print (resolveLocal/resolveBattery)
+    $localGlyphs = [
+        'time'    => '0123456789:',
+        'battery' => '0123456789%V.+ ',
+        'version' => 'v0123456789.',
+    ];
+    $fonts = [];
+    $use = function ($font, $chars) use (&$fonts) {
+        if (!array_key_exists($font, $fonts)) {
+            $fonts[$font] = $chars;
+        } elseif ($fonts[$font] !== null) {
+            $fonts[$font] = ($chars === null) ? null : $fonts[$font] . $chars;
+        }
+    };
+    foreach ($watch['face_ids'] ?? [] as $faceId) {
+        $safeFace = preg_replace('/[^a-zA-Z0-9_-]/', '', $faceId);
+        $faceFile = $facesDir . '/' . $safeFace . '.json';
+        if (!$safeFace || !file_exists($faceFile)) continue;
+        $face = json_decode(file_get_contents($faceFile), true);
+        foreach ($face['complications'] ?? [] as $comp) {
+            $content = $comp['content'] ?? [];
+            $family = $content['family'] ?? 'sans-serif';
+            $family = ($family === 'monospace') ? 'mono' : (($family === 'serif') ? 'serif' : 'sans');
+            $idx = $sizes[(int)($content['size'] ?? 16)] ?? 0;
+            $base = $names[$family][$idx];
+            $bold = !empty($content['bold']);
+            $type = $comp['complication_type'] ?? '';
+            $localType = $type ?: ($comp['complication_id'] ?? '');
+            $boldName = ($family === 'mono') ? $base . 'Bold' : preg_replace('/^(FreeSans|FreeSerif)/', '$1Bold', $base);
+
+            // Text can be edited and resynced without a reflash, so only
+            // the fixed local sets are known
+            if (isset($localGlyphs[$localType])) {
+                $chars = $localGlyphs[$localType];
+            } else {
+                $chars = null;
+                // Stale after refresh_interval minutes (watch_faces.py)
+                if ($type !== 'text' && !empty($content['source'])
+                    && (int)($comp['refresh_interval'] ?? 30) > 0) {
+                    $oblique[$bold ? $boldName : $base] = true;
+                }
+            }
+            $use($bold ? $boldName : $base, $chars);
+            if (!$bold && $type === 'ics-calendar') {
+                $use($boldName, null);
+            }
+        }
+    }
+    ksort($fonts);
+    ksort($oblique);
+    foreach ($fonts as $font => $chars) {
+        if ($chars !== null) {
+            $set = count_chars(preg_replace('/[^\x20-\x7E]/', '', $chars), 3);
+            $fonts[$font] = ($set === '') ? ' ' : $set;
+        }
+    }
+    return $fonts;
+}
+
 $env = $_GET['env'] ?? 'watchy';
 if (!in_array($env, ['watchy', 'stock'], true)) {
     http_response_code(400);
@@ -56,6 +133,7 @@ if (!$firmwareDir || !$buildsDir) {
 }
 
 $configPath = $firmwareDir . '/include/config.h';
+$fontsDir   = $firmwareDir . '/include/crispface_fonts';
 $config = file_get_contents($configPath);
 
 // Bump version (this persists across builds)
@@ -159,6 +237,56 @@ if ($watchId && $env === 'watchy') {
             }
             $config = str_replace("\n#endif", $wifiDefs . "\n#endif", $config);
         }
+
+        // Inject the font subset this watch's faces use (see fonts.h). The
+        // 36/48pt fonts used only by local time, battery and version
+        // complications are cut down to their glyphs, and fonts that can
+        // show stale data get a generated oblique variant (tools/gfxoblique.py).
+        $obliqueFonts = [];
+        $fonts = watchFonts($watch, $dataDir . '/users/' . $watchOwner . '/faces', $obliqueFonts);
+        if (!empty($fonts)) {
+            $fontDefs = "\n#define CRISPFACE_FONT_SUBSET\n";
+            foreach ($fonts as $font => $chars) {
+                $fontDefs .= '#define CRISPFACE_FONT_' . $font . "\n";
+                if ($chars !== null && preg_match('/(36|48)pt7b$/', $font)) {
+                    $subsetCmd = 'python3 tools/gfxsubset.py'
+                        . ' ' . escapeshellarg('include/crispface_fonts/' . $font . '.h')
+                        . ' --chars ' . escapeshellarg($chars)
+                        . ' -o ' . escapeshellarg($fontsDir . '/' . $font . '.subset.h')
+                        . ' 2>&1';
+                    exec('cd ' . escapeshellarg($firmwareDir) . ' && ' . $subsetCmd, $subsetLines, $subsetExit);
+                    if ($subsetExit === 0) {
+                        $fontDefs .= '#define CRISPFACE_GLYPHS_' . $font . "\n";
+                    }
+                }
+            }
+            // Adafruit's own fonts come from the library PlatformIO fetched;
+            // before the first build there is none, and stale text falls back
+            // to shearing the upright glyphs as it is drawn. Scaled Tamzen
+            // sizes (GFXMetrics scale > 1) fall back the same way: their
+            // variant would be expanded to the drawn size, up to 53KB for
+            // Tamzen80x4 against its 2.4KB base
+            foreach (array_keys($obliqueFonts) as $font) {
+                $source = 'include/crispface_fonts/' . $font . '.h';
+                if (!file_exists($firmwareDir . '/' . $source)) {
+                    $source = '.pio/libdeps/' . $env . '/Adafruit GFX Library/Fonts/' . $font . '.h';
+                }
+                if (!file_exists($firmwareDir . '/' . $source)) continue;
+                $scaleRe = '/GFXMetrics\s+' . preg_quote($font, '/')
+                    . 'Metrics\s*=\s*\{\s*\d+\s*,\s*\d+\s*,\s*\d+\s*,\s*(\d+)\s*,/';
+                if (preg_match($scaleRe, file_get_contents($firmwareDir . '/' . $source), $sm) && (int)$sm[1] > 1) {
+                    continue;
+                }
+                $obliqueCmd = 'python3 tools/gfxoblique.py ' . escapeshellarg($source)
+                    . ' -o ' . escapeshellarg($fontsDir . '/' . $font . 'Oblique.h')
+                    . ' 2>&1';
+                exec('cd ' . escapeshellarg($firmwareDir) . ' && ' . $obliqueCmd, $obliqueLines, $obliqueExit);
+                if ($obliqueExit === 0) {
+                    $fontDefs .= '#define CRISPFACE_OBLIQUE_' . $font . "\n";
+                }
+            }
+            $config = str_replace("\n#endif", $fontDefs . "\n#endif", $config);
+        }
     }
 }
 
@@ -185,6 +313,9 @@ $buildOutput = implode("\n", $outputLines);
 
 // Restore persistent config (version-bumped but without per-watch WiFi injection)
 file_put_contents($configPath, $persistentConfig);
+foreach (array_merge(glob($fontsDir . '/*.subset.h') ?: [], glob($fontsDir . '/*Oblique.h') ?: []) as $generated) {
+    @unlink($generated);
+}
 
 if ($exitCode !== 0) {
     http_response_code(500);
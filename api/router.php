@@ -38,6 +38,8 @@ $env = [
     'CONTENT_LENGTH' => $_SERVER['CONTENT_LENGTH'] ?? '',
     'HTTP_COOKIE' => $_SERVER['HTTP_COOKIE'] ?? '',
     'HTTP_AUTHORIZATION' => $_SERVER['HTTP_AUTHORIZATION'] ?? $_SERVER['REDIRECT_HTTP_AUTHORIZATION'] ?? '',
+    'HTTP_IF_NONE_MATCH' => $_SERVER['HTTP_IF_NONE_MATCH'] ?? '',
+    'HTTP_ACCEPT_ENCODING' => $_SERVER['HTTP_ACCEPT_ENCODING'] ?? '',
     'SERVER_NAME' => $_SERVER['SERVER_NAME'] ?? '',
     'SERVER_PORT' => $_SERVER['SERVER_PORT'] ?? '',
     'SCRIPT_NAME' => '/crispface/api/' . $scriptName,
@@ -103,9 +105,14 @@ if ($exitCode !== 0 && $output === '') {
     exit;
 }
 
-// Parse CGI output: headers are separated from body by a blank line
-$parts = explode("\r\n\r\n", $output, 2);
-if (count($parts) < 2) {
+// Parse CGI output: headers are separated from body by a blank line.
+// The body may be compressed, so split at the first blank line of either
+// style rather than trusting a match further in.
+$crlf = strpos($output, "\r\n\r\n");
+$lf = strpos($output, "\n\n");
+if ($crlf !== false && ($lf === false || $crlf < $lf)) {
+    $parts = explode("\r\n\r\n", $output, 2);
+} else {
     $parts = explode("\n\n", $output, 2);
 }
 
@@ -1,12 +1,22 @@
 #!/usr/bin/env python3
 """Watch faces API endpoint.
-GET /crispface/api/watch_faces.py?watch_id=<id>
+GET /crispface/api/watch_faces.py?watch_id=<id>[&layout=<version>]
 Auth: Authorization: Bearer <token>
 
 Returns resolved face JSON with server-side complication values pre-fetched
 and local complications (time, date, battery) flagged for on-device rendering.
+
+The response carries an ETag over its content; a request whose
+If-None-Match holds it gets 304 Not Modified with no body. It is sent
+minified, and compressed when Accept-Encoding allows deflate or gzip.
+
+The full response also carries a layout version: a hash of everything but
+the server values and alerts. A watch that sends the current one back gets
+a delta instead: only the values that differ from the response it holds
+(the one named by If-None-Match), as [face, complication, value] triples,
+plus every alert.
 """
-import sys, os, json, time, re, urllib.parse, subprocess
+import sys, os, json, time, re, hashlib, urllib.parse, subprocess, zlib
 from concurrent.futures import ThreadPoolExecutor, as_completed
 
 sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..', 'lib'))
@@ -18,12 +28,59 @@ API_DIR = os.path.dirname(os.path.abspath(__file__))
 # Local complication types — rendered on-device from RTC/ADC
 LOCAL_TYPES = {'time', 'battery', 'version'}
 
+# zlib window for deflate responses: the watch inflates into a ring of
+# this size (CF_INFLATE_WINDOW in the firmware), so the two must match
+DEFLATE_WBITS = 12
+
+# Complications per face the watch keeps (CF_MAX_COMPS in the firmware);
+# it drops the rest, so a delta carries no values for them
+MAX_COMPS = 24
+
+# Faces the watch keeps (CF_MAX_FACES); later enabled faces are not sent
+MAX_FACES = 20
+
+
+def accepted_encoding():
+    """'deflate' or 'gzip' if the request's Accept-Encoding allows it
+    (deflate first: the watch asks for it), else None."""
+    q = {}
+    for part in os.environ.get('HTTP_ACCEPT_ENCODING', '').split(','):
+        coding, _, params = part.strip().lower().partition(';')
+        weight = 1.0
+        m = re.search(r'q=([0-9.]+)', params)
+        if m:
+            try:
+                weight = float(m.group(1))
+            except ValueError:
+                weight = 0.0
+        if coding:
+            q[coding] = weight
+    for coding in ('deflate', 'gzip'):
+        if q.get(coding, q.get('*', 0)) > 0:
+            return coding
+    return None
+
+
+def respond(data, status='200 OK', etag=None):
+    body = json.dumps(data, separators=(',', ':')).encode()
+    encoding = accepted_encoding()
+    if encoding == 'deflate':
+        z = zlib.compressobj(9, zlib.DEFLATED, DEFLATE_WBITS)
+        body = z.compress(body) + z.flush()
+    elif encoding == 'gzip':
+        z = zlib.compressobj(9, zlib.DEFLATED, 16 + zlib.MAX_WBITS)
+        body = z.compress(body) + z.flush()
 
-def respond(data, status='200 OK'):
     print('Status: ' + status)
     print('Content-Type: application/json')
+    print('Vary: Accept-Encoding')
+    if encoding:
+        print('Content-Encoding: ' + encoding)
+    if etag:
+        print('ETag: ' + etag)
     print()
-    print(json.dumps(data))
+    sys.stdout.flush()
+    sys.stdout.buffer.write(body)
     sys.exit(0)
 
 
@@ -31,6 +88,48 @@ def error(msg, status='400 Bad Request'):
     respond({'success': False, 'error': msg}, status)
 
 
+def content_etag(faces, wifi, now):
+    """Hash of everything the watch keeps from a sync. fetched_at is left
+    out, and alert offsets (seconds from now) are hashed as absolute
+    minutes, so an unchanged calendar keeps its ETag between requests."""
+    def stable(comp):
+        if 'alerts' not in comp:
+            return comp
+        alerts = [dict(a, sec=(now + a.get('sec', 0) + 30) // 60) for a in comp['alerts']]
+        return dict(comp, alerts=alerts)
+
+    body = {
+        'faces': [dict(f, complications=[stable(c) for c in f['complications']]) for f in faces],
+        'wifi': wifi,
+    }
+    canonical = json.dumps(body, sort_keys=True, separators=(',', ':'))
+    return '"' + hashlib.sha256(canonical.encode()).hexdigest()[:32] + '"'
+
+
+def layout_version(faces, wifi):
+    """Hash of the faces without their values and alerts, and the WiFi
+    list. Changes only when a face is edited, added or removed."""
+    def strip(comp):
+        return {k: v for k, v in comp.items() if k not in ('value', 'alerts')}
+
+    body = {
+        'faces': [dict(f, complications=[strip(c) for c in f['complications']]) for f in faces],
+        'wifi': wifi,
+    }
+    canonical = json.dumps(body, sort_keys=True, separators=(',', ':'))
+    return hashlib.sha256(canonical.encode()).hexdigest()[:32]
+
+
+def server_values(faces):
+    """Values of the server complications, keyed 'face:complication'."""
+    values = {}
+    for fi, face in enumerate(faces):
+        for ci, comp in enumerate(face['complications'][:MAX_COMPS]):
+            if not comp.get('local'):
+                values['%d:%d' % (fi, ci)] = comp.get('value', '')
+    return values
+
+
 def resolve_source(source, params):
     """Execute a source script and return the resolved value string."""
     # source is a URL path like /crispface/api/sources/sample_word.py
@@ -143,6 +242,8 @@ for face_id in face_ids:
 
     if face.get('disabled', False):
         continue
+    if len(loaded_faces) >= MAX_FACES:
+        break
 
     face_idx = len(loaded_faces)
     loaded_faces.append(face)
@@ -284,9 +385,58 @@ for face in faces:
         else:
             del comp['alerts']
 
+# ---- Conditional response ----
+
+now = int(time.time())
+wifi = watch.get('wifi_networks', [])
+etag = content_etag(faces, wifi, now)
+
+if_none_match = os.environ.get('HTTP_IF_NONE_MATCH', '')
+held_etags = [t.strip() for t in if_none_match.split(',')]
+if etag in held_etags:
+    print('Status: 304 Not Modified')
+    print('ETag: ' + etag)
+    print()
+    sys.exit(0)
+
+# The values last sent to this watch, to diff a delta against
+layout = layout_version(faces, wifi)
+values = server_values(faces)
+snapshot_file = os.path.join(watches_dir, watch_id + '.sync')
+snapshot = {}
+if os.path.exists(snapshot_file):
+    try:
+        with open(snapshot_file, 'r') as f:
+            snapshot = json.load(f)
+    except Exception:
+        snapshot = {}
+
+with open(snapshot_file, 'w') as f:
+    json.dump({'etag': etag, 'values': values}, f)
+
+if qs.get('layout', [''])[0] == layout:
+    # The watch holds these faces: send only values it lacks
+    base = snapshot.get('values', {}) if snapshot.get('etag') in held_etags else {}
+    changed = []
+    for key, value in values.items():
+        if base.get(key) != value:
+            fi, ci = key.split(':')
+            changed.append([int(fi), int(ci), value])
+    changed.sort(key=lambda v: (v[0], v[1]))
+    alerts = [a for face in faces for comp in face['complications'] for a in comp.get('alerts', [])]
+    respond({
+        'success': True,
+        'delta': True,
+        'layout': layout,
+        'values': changed,
+        'alerts': alerts,
+        'fetched_at': now,
+    }, etag=etag)
+
 respond({
     'success': True,
     'faces': faces,
-    'wifi': watch.get('wifi_networks', []),
-    'fetched_at': int(time.time()),
-})
+    'wifi': wifi,
+    'layout': layout,
+    'fetched_at': now,
+}, etag=etag)
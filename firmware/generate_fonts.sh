@@ -1,5 +1,6 @@
 #!/bin/bash
-# Generate 36pt and 48pt Adafruit GFX font headers from FreeFont TTFs.
+# Generate 36pt and 48pt Adafruit GFX font headers from FreeFont TTFs,
+# plus the Tamzen bitmap fonts, each with a GFXMetrics table.
 # Requires: libfreetype-dev, pkg-config, gcc
 # The Adafruit GFX library bundles 9/12/18/24pt — 36pt and 48pt need generating.
 set -e
@@ -11,6 +12,8 @@ FONTCONVERT="tools/bin/fontconvert"
 SIZES=(36 48)
 FIRST_CHAR=32
 LAST_CHAR=126
+# Optional glyph set per size, e.g. GLYPHS_48="0123456789:" to keep only
+# the time digits (tools/gfxsubset.py). Unset keeps all of ASCII.
 
 # Check TTF sources exist
 if [ ! -f "$FONT_DIR/FreeSans.ttf" ]; then
@@ -57,6 +60,12 @@ for SIZE in "${SIZES[@]}"; do
 
         echo "Generating ${header_name}..."
         "$FONTCONVERT" "$ttf_path" "$SIZE" "$FIRST_CHAR" "$LAST_CHAR" > "$out_path"
+        python3 tools/gfxmetrics.py "$out_path" --append
+        glyphs_var="GLYPHS_${SIZE}"
+        if [ -n "${!glyphs_var}" ]; then
+            python3 tools/gfxsubset.py "$out_path" --chars "${!glyphs_var}" -o "$out_path.tmp"
+            mv "$out_path.tmp" "$out_path"
+        fi
         echo "  -> $out_path"
     done
 done
@@ -66,27 +75,41 @@ echo "=== Generating Tamzen bitmap fonts ==="
 BDF2GFX="tools/bdf2gfx.py"
 TAMZEN_DIR="$FONT_DIR/tamzen/bdf"
 
-# source_bdf font_name scale
+# source_bdf font_name scale [base]
+# Scaled sizes share the glyph data of their 1x base header; the
+# renderer expands each pixel by the scale recorded in GFXMetrics.
 TAMZEN_FONTS=(
     "Tamzen7x13r.bdf  Tamzen13x1      1"
     "Tamzen7x13b.bdf  Tamzen13x1Bold  1"
     "Tamzen8x16r.bdf  Tamzen16x1      1"
     "Tamzen8x16b.bdf  Tamzen16x1Bold  1"
-    "Tamzen7x13r.bdf  Tamzen26x2      2"
-    "Tamzen7x13b.bdf  Tamzen26x2Bold  2"
-    "Tamzen8x16r.bdf  Tamzen32x2      2"
-    "Tamzen8x16b.bdf  Tamzen32x2Bold  2"
-    "Tamzen10x20r.bdf Tamzen60x3      3"
-    "Tamzen10x20b.bdf Tamzen60x3Bold  3"
-    "Tamzen10x20r.bdf Tamzen80x4      4"
-    "Tamzen10x20b.bdf Tamzen80x4Bold  4"
+    "Tamzen10x20r.bdf Tamzen20x1      1"
+    "Tamzen10x20b.bdf Tamzen20x1Bold  1"
+    "Tamzen7x13r.bdf  Tamzen26x2      2 Tamzen13x1"
+    "Tamzen7x13b.bdf  Tamzen26x2Bold  2 Tamzen13x1Bold"
+    "Tamzen8x16r.bdf  Tamzen32x2      2 Tamzen16x1"
+    "Tamzen8x16b.bdf  Tamzen32x2Bold  2 Tamzen16x1Bold"
+    "Tamzen10x20r.bdf Tamzen60x3      3 Tamzen20x1"
+    "Tamzen10x20b.bdf Tamzen60x3Bold  3 Tamzen20x1Bold"
+    "Tamzen10x20r.bdf Tamzen80x4      4 Tamzen20x1"
+    "Tamzen10x20b.bdf Tamzen80x4Bold  4 Tamzen20x1Bold"
 )
 
 for entry in "${TAMZEN_FONTS[@]}"; do
-    read -r bdf_file font_name scale <<< "$entry"
+    read -r bdf_file font_name scale base <<< "$entry"
     echo "Generating ${font_name}..."
-    python3 "$BDF2GFX" "$TAMZEN_DIR/$bdf_file" "$font_name" --scale "$scale" -o "$OUT_DIR/${font_name}.h"
+    python3 "$BDF2GFX" "$TAMZEN_DIR/$bdf_file" "$font_name" --scale "$scale" \
+        ${base:+--base "$base"} -o "$OUT_DIR/${font_name}.h"
     echo "  -> $OUT_DIR/${font_name}.h"
 done
 
+# Oblique (stale text) variants, e.g. OBLIQUE="Tamzen16x1 FreeSans48pt7b".
+# Per-watch builds generate the ones their faces need (build_firmware.php),
+# except for scaled Tamzen sizes, whose variants are expanded to the drawn
+# size (~53KB for Tamzen80x4) and which are sheared while blitting instead.
+for font_name in $OBLIQUE; do
+    echo "Generating ${font_name}Oblique..."
+    python3 tools/gfxoblique.py "$OUT_DIR/${font_name}.h" -o "$OUT_DIR/${font_name}Oblique.h"
+done
+
 echo "Done. Generated $(ls "$OUT_DIR"/*.h 2>/dev/null | wc -l) font headers."
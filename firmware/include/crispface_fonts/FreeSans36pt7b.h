@@ -1549,3 +1549,18 @@ const GFXfont FreeSans36pt7b PROGMEM = {
   0x20, 0x7E, 85 };
 
 // Approx. 18020 bytes
+
+#include "GFXMetrics.h"
+
+constexpr uint8_t FreeSans36pt7bAdvance[] = {
+   18,  24,  24,  39,  39,  63,  47,  14,  24,  24,  28,  41,  20,  24,  18,  20,
+   39,  39,  40,  39,  39,  39,  39,  39,  39,  39,  18,  18,  41,  41,  41,  39,
+   72,  47,  47,  50,  50,  45,  43,  54,  51,  20,  37,  48,  40,  60,  52,  56,
+   47,  56,  50,  47,  45,  51,  46,  67,  47,  48,  44,  20,  20,  20,  33,  39,
+   18,  39,  40,  36,  40,  38,  20,  39,  38,  16,  17,  37,  15,  58,  38,  38,
+   40,  40,  24,  35,  20,  38,  35,  51,  34,  34,  34,  24,  18,  24,  36,
+};
+
+constexpr GFXMetrics FreeSans36pt7bMetrics = {
+  51, 16, 85, 1, 0x20, 0x7E, FreeSans36pt7bAdvance
+};
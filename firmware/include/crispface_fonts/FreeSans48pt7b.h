@@ -2616,3 +2616,18 @@ const GFXfont FreeSans48pt7b PROGMEM = {
   (GFXglyph *)FreeSans48pt7bGlyphs,
   0x20, 0x7E, 92 };
 
+
+#include "GFXMetrics.h"
+
+constexpr uint8_t FreeSans48pt7bAdvance[] = {
+   24,  31,  31,  52,  52,  84,  63,  19,  31,  31,  37,  55,  26,  31,  23,  26,
+   52,  52,  53,  52,  52,  52,  52,  52,  52,  52,  23,  24,  55,  55,  55,  52,
+   95,  63,  62,  67,  66,  59,  56,  72,  68,  26,  50,  63,  53,  80,  69,  74,
+   62,  74,  67,  63,  59,  68,  61,  88,  62,  64,  58,  26,  26,  26,  44,  52,
+   24,  51,  53,  48,  53,  50,  26,  52,  50,  21,  23,  48,  20,  77,  50,  50,
+   53,  53,  31,  46,  26,  50,  47,  68,  45,  45,  46,  31,  23,  31,  47,
+};
+
+constexpr GFXMetrics FreeSans48pt7bMetrics = {
+  69, 20, 92, 1, 0x20, 0x7E, FreeSans48pt7bAdvance
+};
@@ -1656,3 +1656,18 @@ const GFXfont FreeSansBold36pt7b PROGMEM = {
   0x20, 0x7E, 85 };
 
 // Approx. 19303 bytes
+
+#include "GFXMetrics.h"
+
+constexpr uint8_t FreeSansBold36pt7bAdvance[] = {
+   20,  24,  34,  39,  39,  63,  51,  18,  24,  24,  28,  41,  18,  24,  18,  20,
+   39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  18,  18,  41,  41,  41,  43,
+   69,  49,  50,  51,  51,  47,  45,  55,  53,  22,  41,  52,  44,  62,  53,  56,
+   48,  56,  51,  48,  46,  52,  47,  68,  48,  46,  43,  24,  20,  24,  41,  39,
+   18,  40,  44,  40,  44,  41,  24,  43,  43,  20,  20,  40,  19,  63,  44,  44,
+   44,  44,  28,  39,  24,  44,  38,  55,  39,  39,  36,  28,  20,  28,  36,
+};
+
+constexpr GFXMetrics FreeSansBold36pt7bMetrics = {
+  51, 17, 85, 1, 0x20, 0x7E, FreeSansBold36pt7bAdvance
+};
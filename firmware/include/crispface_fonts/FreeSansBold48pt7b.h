@@ -2819,3 +2819,18 @@ const GFXfont FreeSansBold48pt7b PROGMEM = {
   (GFXglyph *)FreeSansBold48pt7bGlyphs,
   0x20, 0x7E, 91 };
 
+
+#include "GFXMetrics.h"
+
+constexpr uint8_t FreeSansBold48pt7bAdvance[] = {
+   26,  31,  45,  52,  52,  84,  68,  24,  31,  31,  37,  55,  23,  31,  23,  26,
+   52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  23,  23,  55,  55,  55,  57,
+   92,  66,  66,  68,  68,  63,  59,  72,  70,  29,  54,  68,  58,  82,  71,  74,
+   64,  74,  68,  64,  61,  69,  62,  90,  63,  60,  57,  31,  26,  31,  55,  52,
+   23,  53,  58,  52,  58,  55,  32,  58,  57,  26,  26,  53,  25,  84,  58,  58,
+   58,  58,  37,  52,  32,  58,  51,  73,  52,  52,  48,  37,  26,  37,  47,
+};
+
+constexpr GFXMetrics FreeSansBold48pt7bMetrics = {
+  69, 20, 91, 1, 0x20, 0x7E, FreeSansBold48pt7bAdvance
+};
@@ -1450,3 +1450,18 @@ const GFXfont FreeSerif36pt7b PROGMEM = {
   0x20, 0x7E, 85 };
 
 // Approx. 16827 bytes
+
+#include "GFXMetrics.h"
+
+constexpr uint8_t FreeSerif36pt7bAdvance[] = {
+   18,  24,  28,  35,  36,  59,  55,  14,  24,  24,  36,  40,  18,  24,  18,  21,
+   35,  36,  35,  36,  36,  36,  35,  36,  36,  35,  18,  18,  40,  40,  40,  32,
+   61,  51,  45,  48,  51,  43,  40,  51,  51,  23,  27,  50,  43,  63,  51,  51,
+   41,  51,  47,  38,  43,  51,  50,  67,  51,  50,  44,  24,  21,  24,  33,  35,
+   18,  31,  36,  32,  35,  32,  26,  33,  35,  20,  25,  36,  18,  55,  35,  35,
+   35,  35,  24,  26,  20,  35,  33,  48,  34,  33,  30,  34,  14,  34,  35,
+};
+
+constexpr GFXMetrics FreeSerif36pt7bMetrics = {
+  47, 16, 85, 1, 0x20, 0x7E, FreeSerif36pt7bAdvance
+};
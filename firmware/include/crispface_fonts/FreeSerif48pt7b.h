@@ -2457,3 +2457,18 @@ const GFXfont FreeSerif48pt7b PROGMEM = {
   0x20, 0x7E, 113 };
 
 // Approx. 28920 bytes
+
+#include "GFXMetrics.h"
+
+constexpr uint8_t FreeSerif48pt7bAdvance[] = {
+   24,  31,  38,  47,  47,  78,  73,  19,  31,  31,  47,  53,  24,  31,  23,  28,
+   47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  24,  24,  53,  53,  53,  42,
+   81,  68,  59,  63,  68,  57,  53,  68,  67,  31,  36,  67,  57,  83,  68,  68,
+   54,  68,  63,  50,  57,  68,  66,  89,  67,  66,  58,  31,  28,  31,  44,  47,
+   23,  41,  47,  42,  47,  42,  35,  44,  47,  26,  33,  48,  24,  73,  46,  46,
+   47,  47,  32,  34,  27,  46,  44,  64,  45,  44,  39,  45,  19,  45,  47,
+};
+
+constexpr GFXMetrics FreeSerif48pt7bMetrics = {
+  62, 21, 113, 1, 0x20, 0x7E, FreeSerif48pt7bAdvance
+};
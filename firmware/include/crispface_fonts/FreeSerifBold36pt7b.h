@@ -1581,3 +1581,18 @@ const GFXfont FreeSerifBold36pt7b PROGMEM = {
   0x20, 0x7E, 85 };
 
 // Approx. 18404 bytes
+
+#include "GFXMetrics.h"
+
+constexpr uint8_t FreeSerifBold36pt7bAdvance[] = {
+   18,  24,  39,  35,  36,  71,  59,  20,  24,  24,  36,  48,  18,  24,  18,  20,
+   35,  36,  36,  36,  36,  36,  35,  35,  36,  35,  24,  24,  48,  48,  48,  35,
+   66,  51,  47,  50,  52,  48,  44,  55,  55,  28,  36,  55,  47,  68,  51,  55,
+   45,  55,  51,  40,  46,  51,  50,  70,  51,  50,  46,  24,  20,  24,  41,  35,
+   24,  35,  39,  31,  39,  32,  28,  35,  39,  21,  28,  39,  20,  59,  39,  36,
+   39,  39,  30,  29,  24,  40,  34,  50,  36,  34,  32,  28,  16,  28,  37,
+};
+
+constexpr GFXMetrics FreeSerifBold36pt7bMetrics = {
+  48, 15, 85, 1, 0x20, 0x7E, FreeSerifBold36pt7bAdvance
+};
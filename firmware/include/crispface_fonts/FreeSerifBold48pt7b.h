@@ -2688,3 +2688,18 @@ const GFXfont FreeSerifBold48pt7b PROGMEM = {
   0x20, 0x7E, 113 };
 
 // Approx. 31688 bytes
+
+#include "GFXMetrics.h"
+
+constexpr uint8_t FreeSerifBold48pt7bAdvance[] = {
+   24,  31,  52,  47,  48,  94,  78,  26,  31,  31,  48,  64,  23,  31,  23,  26,
+   47,  47,  47,  47,  47,  47,  47,  47,  47,  47,  31,  31,  64,  64,  64,  47,
+   87,  68,  62,  67,  69,  63,  58,  73,  73,  37,  47,  73,  63,  89,  68,  73,
+   60,  73,  68,  53,  61,  68,  66,  92,  67,  66,  61,  31,  26,  31,  55,  47,
+   31,  47,  51,  41,  52,  42,  37,  47,  52,  28,  38,  52,  26,  78,  52,  47,
+   51,  51,  40,  38,  31,  53,  45,  66,  48,  45,  42,  37,  21,  37,  49,
+};
+
+constexpr GFXMetrics FreeSerifBold48pt7bMetrics = {
+  64, 20, 113, 1, 0x20, 0x7E, FreeSerifBold48pt7bAdvance
+};
@@ -0,0 +1,26 @@
+#ifndef GFXMETRICS_H
+#define GFXMETRICS_H
+
+#include <Adafruit_GFX.h>
+
+// Layout metrics emitted next to each generated GFXfont by
+// tools/bdf2gfx.py and tools/gfxmetrics.py, so text is measured from
+// tables instead of Adafruit_GFX::getTextBounds().
+//   ascent/descent  rows above / from the baseline down, over 'A' and 'y'
+//                   (the line box the renderer lays text out with)
+//   lineHeight      the font's yAdvance
+//   scale           pixel multiplier: the GFXfont's glyphs are stored at
+//                   1/scale size and expanded to scale x scale blocks when
+//                   drawn (all other fields are at the drawn size)
+//   advance         xAdvance of each glyph, first..last
+struct GFXMetrics {
+    uint8_t  ascent;
+    uint8_t  descent;
+    uint8_t  lineHeight;
+    uint8_t  scale;
+    uint16_t first;
+    uint16_t last;
+    const uint8_t* advance;
+};
+
+#endif // GFXMETRICS_H
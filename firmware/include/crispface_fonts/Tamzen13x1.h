@@ -2,6 +2,7 @@
 #define TAMZEN13X1_H
 
 #include <Adafruit_GFX.h>
+#include "GFXMetrics.h"
 
 const uint8_t Tamzen13x1Bitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -205,4 +206,17 @@ const GFXfont Tamzen13x1 PROGMEM = {
   0x20, 0x7E, 13
 };
 
+constexpr uint8_t Tamzen13x1Advance[] = {
+    7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+    7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+    7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+    7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+    7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+    7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+};
+
+constexpr GFXMetrics Tamzen13x1Metrics = {
+  11, 2, 13, 1, 0x20, 0x7E, Tamzen13x1Advance
+};
+
 #endif // TAMZEN13X1_H
@@ -2,6 +2,7 @@
 #define TAMZEN13X1BOLD_H
 
 #include <Adafruit_GFX.h>
+#include "GFXMetrics.h"
 
 const uint8_t Tamzen13x1BoldBitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -205,4 +206,17 @@ const GFXfont Tamzen13x1Bold PROGMEM = {
   0x20, 0x7E, 13
 };
 
+constexpr uint8_t Tamzen13x1BoldAdvance[] = {
+    7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+    7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+    7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+    7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+    7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+    7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+};
+
+constexpr GFXMetrics Tamzen13x1BoldMetrics = {
+  11, 2, 13, 1, 0x20, 0x7E, Tamzen13x1BoldAdvance
+};
+
 #endif // TAMZEN13X1BOLD_H
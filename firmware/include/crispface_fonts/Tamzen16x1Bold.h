@@ -2,6 +2,7 @@
 #define TAMZEN16X1BOLD_H
 
 #include <Adafruit_GFX.h>
+#include "GFXMetrics.h"
 
 const uint8_t Tamzen16x1BoldBitmaps[] PROGMEM = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -238,4 +239,17 @@ const GFXfont Tamzen16x1Bold PROGMEM = {
   0x20, 0x7E, 16
 };
 
+constexpr uint8_t Tamzen16x1BoldAdvance[] = {
+    8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+    8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+    8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+    8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+    8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+    8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+};
+
+constexpr GFXMetrics Tamzen16x1BoldMetrics = {
+  13, 4, 16, 1, 0x20, 0x7E, Tamzen16x1BoldAdvance
+};
+
 #endif // TAMZEN16X1BOLD_H
@@ -0,0 +1,325 @@
+#ifndef TAMZEN20X1_H
+#define TAMZEN20X1_H
+
+#include <Adafruit_GFX.h>
+#include "GFXMetrics.h"
+
+const uint8_t Tamzen20x1Bitmaps[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x88, 0x22, 0x08, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x44, 0x11, 0x1F, 0xE2, 0x20,
+  0x88, 0x22, 0x08, 0x8F, 0xF1, 0x10, 0x44, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x20, 0x3E, 0x10, 0x44,
+  0x01, 0x00, 0x3E, 0x00, 0x40, 0x11, 0x04, 0x3E, 0x02, 0x00, 0x80, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x12,
+  0x24, 0x90, 0xC8, 0x04, 0x02, 0x01, 0x30, 0x92, 0x44, 0x80, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x48,
+  0x12, 0x04, 0x80, 0xC0, 0x30, 0x12, 0x44, 0x51, 0x08, 0x45, 0x0E, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
+  0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x04, 0x02, 0x00, 0x80, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10,
+  0x02, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x40, 0x08, 0x01, 0x00, 0x40, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08,
+  0x02, 0x01, 0x00, 0x40, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x90, 0xA8, 0x1C, 0x0A, 0x84, 0x90,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x20, 0x7F, 0x02, 0x00,
+  0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x80, 0x20, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x02, 0x00, 0x80, 0x40,
+  0x10, 0x08, 0x02, 0x01, 0x00, 0x40, 0x20, 0x08, 0x04, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x10, 0x44,
+  0x31, 0x14, 0x49, 0x14, 0x46, 0x11, 0x04, 0x41, 0x0F, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x06,
+  0x02, 0x81, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x1F, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
+  0x10, 0x40, 0x10, 0x04, 0x02, 0x01, 0x00, 0x80, 0x40, 0x20, 0x1F, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0x00, 0x80, 0x40, 0x20, 0x1E, 0x00, 0x40, 0x10, 0x04, 0x41, 0x0F,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x01, 0x80, 0xA0, 0x48, 0x22, 0x10, 0x87, 0xF0, 0x08, 0x02,
+  0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0x10, 0x04, 0x01, 0x00, 0x7E, 0x00, 0x40, 0x10, 0x04,
+  0x41, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1C, 0x08, 0x04, 0x01, 0x00, 0x7E, 0x10, 0x44, 0x11,
+  0x04, 0x41, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x20, 0x08, 0x04, 0x01, 0x00,
+  0x80, 0x20, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x10, 0x44, 0x11, 0x04, 0x3E, 0x10,
+  0x44, 0x11, 0x04, 0x41, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x10, 0x44, 0x11, 0x04, 0x41,
+  0x0F, 0xC0, 0x10, 0x04, 0x02, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x80, 0x20, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
+  0x80, 0x40, 0x20, 0x04, 0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+  0x04, 0x00, 0x80, 0x10, 0x02, 0x01, 0x00, 0x80, 0x40, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+  0x41, 0x00, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
+  0x84, 0x40, 0xA0, 0x28, 0xEA, 0x4A, 0x92, 0xA4, 0xA9, 0x2A, 0x34, 0x80,
+  0x10, 0x02, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1C, 0x08, 0x84, 0x11, 0x04, 0x41, 0x1F, 0xC4, 0x11, 0x04,
+  0x41, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7E, 0x10, 0x44, 0x11, 0x04, 0x7E, 0x10, 0x44, 0x11,
+  0x04, 0x41, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0x08, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04,
+  0x01, 0x00, 0x20, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x84, 0x11, 0x04, 0x41, 0x10,
+  0x44, 0x11, 0x04, 0x42, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x04, 0x01, 0x00, 0x7E,
+  0x10, 0x04, 0x01, 0x00, 0x40, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x10, 0x04, 0x01, 0x00,
+  0x7E, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x08, 0x04, 0x01,
+  0x00, 0x40, 0x11, 0xC4, 0x11, 0x04, 0x21, 0x07, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 0x44,
+  0x11, 0x04, 0x7F, 0x10, 0x44, 0x11, 0x04, 0x41, 0x10, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x02,
+  0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x1F, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x11, 0x04, 0x41, 0x0F, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x41, 0x10, 0x84, 0x41, 0x20, 0x70, 0x1C, 0x04, 0x81, 0x10, 0x42, 0x10,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40,
+  0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x41, 0x18, 0xC5, 0x51, 0x24, 0x49, 0x10, 0x44, 0x11, 0x04,
+  0x41, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x41, 0x18, 0x45, 0x11, 0x24, 0x45, 0x10, 0xC4, 0x11,
+  0x04, 0x41, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x44, 0x09, 0x02, 0x40, 0x90, 0x24,
+  0x09, 0x02, 0x21, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x10, 0x44, 0x11, 0x04, 0x41, 0x1F,
+  0x84, 0x01, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x44, 0x09, 0x02, 0x40,
+  0x90, 0x24, 0x09, 0x02, 0x21, 0x07, 0x80, 0x40, 0x0E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x10, 0x44, 0x11, 0x04,
+  0x41, 0x1F, 0x84, 0x81, 0x10, 0x42, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x10, 0x44, 0x01,
+  0x00, 0x38, 0x01, 0x80, 0x10, 0x04, 0x41, 0x0F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x82, 0x00,
+  0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x10,
+  0x44, 0x11, 0x04, 0x41, 0x10, 0x44, 0x11, 0x04, 0x41, 0x0F, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41,
+  0x10, 0x44, 0x11, 0x04, 0x22, 0x08, 0x81, 0x40, 0x50, 0x08, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x41, 0x10, 0x44, 0x11, 0x04, 0x41, 0x12, 0x44, 0x91, 0x24, 0x55, 0x18,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x41, 0x10, 0x42, 0x20, 0x50, 0x08, 0x02, 0x01, 0x40, 0x88, 0x41,
+  0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x41, 0x08, 0x82, 0x20, 0x50, 0x14, 0x02, 0x00, 0x80, 0x20,
+  0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x40, 0x10, 0x08, 0x02, 0x01, 0x00,
+  0x40, 0x20, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF8, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02,
+  0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x01, 0x00, 0x20, 0x08, 0x01, 0x00, 0x40, 0x08, 0x02,
+  0x00, 0x40, 0x10, 0x02, 0x00, 0x80, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02,
+  0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x3E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x14, 0x08, 0x84, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xE0, 0x04, 0x01, 0x0F, 0xC4, 0x11, 0x04, 0x43, 0x0F, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x40,
+  0x10, 0x05, 0xC1, 0x88, 0x41, 0x10, 0x44, 0x11, 0x04, 0x42, 0x1F, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xE0, 0x84, 0x40, 0x10, 0x04, 0x01, 0x00, 0x21, 0x07,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x01, 0x00, 0x41, 0xF0, 0x84, 0x41, 0x10, 0x44, 0x11, 0x04, 0x23,
+  0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x84, 0x41, 0x1F, 0xC4, 0x01, 0x00,
+  0x20, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF0, 0x40, 0x10, 0x04, 0x07, 0xF0, 0x40, 0x10, 0x04, 0x01, 0x00,
+  0x40, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC8, 0x8C, 0x41, 0x10, 0x42,
+  0x20, 0x70, 0x20, 0x0F, 0x84, 0x11, 0x04, 0x3E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x10, 0x04, 0xE1, 0x44, 0x61, 0x10,
+  0x44, 0x11, 0x04, 0x41, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x07, 0x80, 0x20, 0x08,
+  0x02, 0x00, 0x80, 0x20, 0x08, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x10,
+  0x04, 0x01, 0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x20, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04, 0x21,
+  0x10, 0x48, 0x14, 0x06, 0x81, 0x10, 0x42, 0x10, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x08, 0x02, 0x00,
+  0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x01, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0x33, 0x32, 0x88, 0xA2, 0x28, 0x8A, 0x22, 0x88, 0xA2, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xE1, 0x44, 0x61, 0x10, 0x44, 0x11, 0x04, 0x41, 0x10, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xC0, 0x88, 0x41, 0x10, 0x44, 0x11, 0x04, 0x22, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xC1, 0x88, 0x41, 0x10, 0x44, 0x11, 0x04, 0x42,
+  0x1F, 0x04, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x84, 0x41, 0x10, 0x44, 0x11, 0x04,
+  0x23, 0x07, 0x40, 0x10, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xE1, 0x44, 0x60, 0x10, 0x04, 0x01,
+  0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0x04, 0x40, 0x0E, 0x00,
+  0x60, 0x04, 0x41, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x07, 0xF0, 0x40, 0x10, 0x04,
+  0x01, 0x00, 0x40, 0x10, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x04, 0x41,
+  0x10, 0x44, 0x11, 0x0C, 0x45, 0x0E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x04,
+  0x22, 0x08, 0x81, 0x40, 0x50, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0A,
+  0x02, 0x88, 0xA2, 0x28, 0x8A, 0x22, 0x88, 0x9D, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x08, 0x84, 0x12, 0x03, 0x00, 0xC0, 0x48, 0x21, 0x10, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x11, 0x04, 0x41, 0x10, 0x44, 0x10, 0x8C, 0x1D, 0x00, 0x40, 0x10,
+  0x08, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xF0, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0x40, 0x1F, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x10,
+  0x04, 0x01, 0x00, 0x40, 0x10, 0x08, 0x1C, 0x00, 0x80, 0x10, 0x04, 0x01,
+  0x00, 0x40, 0x10, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08,
+  0x02, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x20, 0x08, 0x02, 0x00, 0x80, 0x20, 0x04, 0x00, 0xE0, 0x40, 0x20,
+  0x08, 0x02, 0x00, 0x80, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xC2, 0x48, 0x91, 0x24, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const GFXglyph Tamzen20x1Glyphs[] PROGMEM = {
+  {     0,  10,  20,  10,    0,  -14 },  // 0x20 ' '
+  {    25,  10,  20,  10,    0,  -14 },  // 0x21 '!'
+  {    50,  10,  20,  10,    0,  -14 },  // 0x22 '"'
+  {    75,  10,  20,  10,    0,  -14 },  // 0x23 '#'
+  {   100,  10,  20,  10,    0,  -14 },  // 0x24 '$'
+  {   125,  10,  20,  10,    0,  -14 },  // 0x25 '%'
+  {   150,  10,  20,  10,    0,  -14 },  // 0x26 '&'
+  {   175,  10,  20,  10,    0,  -14 },  // 0x27 '''
+  {   200,  10,  20,  10,    0,  -14 },  // 0x28 '('
+  {   225,  10,  20,  10,    0,  -14 },  // 0x29 ')'
+  {   250,  10,  20,  10,    0,  -14 },  // 0x2A '*'
+  {   275,  10,  20,  10,    0,  -14 },  // 0x2B '+'
+  {   300,  10,  20,  10,    0,  -14 },  // 0x2C ','
+  {   325,  10,  20,  10,    0,  -14 },  // 0x2D '-'
+  {   350,  10,  20,  10,    0,  -14 },  // 0x2E '.'
+  {   375,  10,  20,  10,    0,  -14 },  // 0x2F '/'
+  {   400,  10,  20,  10,    0,  -14 },  // 0x30 '0'
+  {   425,  10,  20,  10,    0,  -14 },  // 0x31 '1'
+  {   450,  10,  20,  10,    0,  -14 },  // 0x32 '2'
+  {   475,  10,  20,  10,    0,  -14 },  // 0x33 '3'
+  {   500,  10,  20,  10,    0,  -14 },  // 0x34 '4'
+  {   525,  10,  20,  10,    0,  -14 },  // 0x35 '5'
+  {   550,  10,  20,  10,    0,  -14 },  // 0x36 '6'
+  {   575,  10,  20,  10,    0,  -14 },  // 0x37 '7'
+  {   600,  10,  20,  10,    0,  -14 },  // 0x38 '8'
+  {   625,  10,  20,  10,    0,  -14 },  // 0x39 '9'
+  {   650,  10,  20,  10,    0,  -14 },  // 0x3A ':'
+  {   675,  10,  20,  10,    0,  -14 },  // 0x3B ';'
+  {   700,  10,  20,  10,    0,  -14 },  // 0x3C '<'
+  {   725,  10,  20,  10,    0,  -14 },  // 0x3D '='
+  {   750,  10,  20,  10,    0,  -14 },  // 0x3E '>'
+  {   775,  10,  20,  10,    0,  -14 },  // 0x3F '?'
+  {   800,  10,  20,  10,    0,  -14 },  // 0x40 '@'
+  {   825,  10,  20,  10,    0,  -14 },  // 0x41 'A'
+  {   850,  10,  20,  10,    0,  -14 },  // 0x42 'B'
+  {   875,  10,  20,  10,    0,  -14 },  // 0x43 'C'
+  {   900,  10,  20,  10,    0,  -14 },  // 0x44 'D'
+  {   925,  10,  20,  10,    0,  -14 },  // 0x45 'E'
+  {   950,  10,  20,  10,    0,  -14 },  // 0x46 'F'
+  {   975,  10,  20,  10,    0,  -14 },  // 0x47 'G'
+  {  1000,  10,  20,  10,    0,  -14 },  // 0x48 'H'
+  {  1025,  10,  20,  10,    0,  -14 },  // 0x49 'I'
+  {  1050,  10,  20,  10,    0,  -14 },  // 0x4A 'J'
+  {  1075,  10,  20,  10,    0,  -14 },  // 0x4B 'K'
+  {  1100,  10,  20,  10,    0,  -14 },  // 0x4C 'L'
+  {  1125,  10,  20,  10,    0,  -14 },  // 0x4D 'M'
+  {  1150,  10,  20,  10,    0,  -14 },  // 0x4E 'N'
+  {  1175,  10,  20,  10,    0,  -14 },  // 0x4F 'O'
+  {  1200,  10,  20,  10,    0,  -14 },  // 0x50 'P'
+  {  1225,  10,  20,  10,    0,  -14 },  // 0x51 'Q'
+  {  1250,  10,  20,  10,    0,  -14 },  // 0x52 'R'
+  {  1275,  10,  20,  10,    0,  -14 },  // 0x53 'S'
+  {  1300,  10,  20,  10,    0,  -14 },  // 0x54 'T'
+  {  1325,  10,  20,  10,    0,  -14 },  // 0x55 'U'
+  {  1350,  10,  20,  10,    0,  -14 },  // 0x56 'V'
+  {  1375,  10,  20,  10,    0,  -14 },  // 0x57 'W'
+  {  1400,  10,  20,  10,    0,  -14 },  // 0x58 'X'
+  {  1425,  10,  20,  10,    0,  -14 },  // 0x59 'Y'
+  {  1450,  10,  20,  10,    0,  -14 },  // 0x5A 'Z'
+  {  1475,  10,  20,  10,    0,  -14 },  // 0x5B '['
+  {  1500,  10,  20,  10,    0,  -14 },  // 0x5C '\'
+  {  1525,  10,  20,  10,    0,  -14 },  // 0x5D ']'
+  {  1550,  10,  20,  10,    0,  -14 },  // 0x5E '^'
+  {  1575,  10,  20,  10,    0,  -14 },  // 0x5F '_'
+  {  1600,  10,  20,  10,    0,  -14 },  // 0x60 '`'
+  {  1625,  10,  20,  10,    0,  -14 },  // 0x61 'a'
+  {  1650,  10,  20,  10,    0,  -14 },  // 0x62 'b'
+  {  1675,  10,  20,  10,    0,  -14 },  // 0x63 'c'
+  {  1700,  10,  20,  10,    0,  -14 },  // 0x64 'd'
+  {  1725,  10,  20,  10,    0,  -14 },  // 0x65 'e'
+  {  1750,  10,  20,  10,    0,  -14 },  // 0x66 'f'
+  {  1775,  10,  20,  10,    0,  -14 },  // 0x67 'g'
+  {  1800,  10,  20,  10,    0,  -14 },  // 0x68 'h'
+  {  1825,  10,  20,  10,    0,  -14 },  // 0x69 'i'
+  {  1850,  10,  20,  10,    0,  -14 },  // 0x6A 'j'
+  {  1875,  10,  20,  10,    0,  -14 },  // 0x6B 'k'
+  {  1900,  10,  20,  10,    0,  -14 },  // 0x6C 'l'
+  {  1925,  10,  20,  10,    0,  -14 },  // 0x6D 'm'
+  {  1950,  10,  20,  10,    0,  -14 },  // 0x6E 'n'
+  {  1975,  10,  20,  10,    0,  -14 },  // 0x6F 'o'
+  {  2000,  10,  20,  10,    0,  -14 },  // 0x70 'p'
+  {  2025,  10,  20,  10,    0,  -14 },  // 0x71 'q'
+  {  2050,  10,  20,  10,    0,  -14 },  // 0x72 'r'
+  {  2075,  10,  20,  10,    0,  -14 },  // 0x73 's'
+  {  2100,  10,  20,  10,    0,  -14 },  // 0x74 't'
+  {  2125,  10,  20,  10,    0,  -14 },  // 0x75 'u'
+  {  2150,  10,  20,  10,    0,  -14 },  // 0x76 'v'
+  {  2175,  10,  20,  10,    0,  -14 },  // 0x77 'w'
+  {  2200,  10,  20,  10,    0,  -14 },  // 0x78 'x'
+  {  2225,  10,  20,  10,    0,  -14 },  // 0x79 'y'
+  {  2250,  10,  20,  10,    0,  -14 },  // 0x7A 'z'
+  {  2275,  10,  20,  10,    0,  -14 },  // 0x7B '{'
+  {  2300,  10,  20,  10,    0,  -14 },  // 0x7C '|'
+  {  2325,  10,  20,  10,    0,  -14 },  // 0x7D '}'
+  {  2350,  10,  20,  10,    0,  -14 },  // 0x7E '~'
+};
+
+const GFXfont Tamzen20x1 PROGMEM = {
+  (uint8_t  *)Tamzen20x1Bitmaps,
+  (GFXglyph *)Tamzen20x1Glyphs,
+  0x20, 0x7E, 20
+};
+
+constexpr uint8_t Tamzen20x1Advance[] = {
+   10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+   10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+   10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+   10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+   10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+   10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+};
+
+constexpr GFXMetrics Tamzen20x1Metrics = {
+  14, 6, 20, 1, 0x20, 0x7E, Tamzen20x1Advance
+};
+
+#endif // TAMZEN20X1_H
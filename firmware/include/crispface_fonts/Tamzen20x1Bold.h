@@ -0,0 +1,325 @@
+#ifndef TAMZEN20X1BOLD_H
+#define TAMZEN20X1BOLD_H
+
+#include <Adafruit_GFX.h>
+#include "GFXMetrics.h"
+
+const uint8_t Tamzen20x1BoldBitmaps[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x3C, 0x0F, 0x03, 0xC0, 0x60, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x98, 0x66, 0x19, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x66, 0x19, 0x9F, 0xF3, 0x30,
+  0xCC, 0x33, 0x0C, 0xCF, 0xF9, 0x98, 0x66, 0x19, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x30, 0x3E, 0x18, 0xC6,
+  0x01, 0x80, 0x3E, 0x00, 0xC0, 0x31, 0x8C, 0x3E, 0x06, 0x01, 0x80, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x36,
+  0x6D, 0xB1, 0xD8, 0x0C, 0x06, 0x03, 0x71, 0xB6, 0xCD, 0x81, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0xD8,
+  0x36, 0x0D, 0x81, 0xC0, 0x70, 0x36, 0xCC, 0xF3, 0x18, 0xCF, 0x1E, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x0C, 0x06, 0x01, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30,
+  0x06, 0x01, 0x80, 0x30, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0xC0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x03, 0x00, 0xC0, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0xD8, 0xFC, 0x1E, 0x0F, 0xC6, 0xD8,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x30, 0x7F, 0x83, 0x00,
+  0xC0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1C, 0x07, 0x00, 0xC0, 0x30, 0x38, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x03, 0x00, 0xC0, 0x60,
+  0x18, 0x0C, 0x03, 0x01, 0x80, 0x60, 0x30, 0x0C, 0x06, 0x01, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x18, 0xC6,
+  0x31, 0x9C, 0x6F, 0x1E, 0xC7, 0x31, 0x8C, 0x63, 0x0F, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x07,
+  0x03, 0xC1, 0xB0, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x1F, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
+  0x18, 0xC0, 0x30, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x1F, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0x00, 0xC0, 0x60, 0x30, 0x1E, 0x00, 0xC0, 0x30, 0x0C, 0x63, 0x0F,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x01, 0xC0, 0xF0, 0x6C, 0x33, 0x18, 0xC7, 0xF8, 0x0C, 0x03,
+  0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0x18, 0x06, 0x01, 0x80, 0x7E, 0x00, 0xC0, 0x30, 0x0C,
+  0x63, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1C, 0x0C, 0x06, 0x01, 0x80, 0x7E, 0x18, 0xC6, 0x31,
+  0x8C, 0x63, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xC0, 0x60, 0x18, 0x0C, 0x03, 0x01,
+  0x80, 0x60, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x18, 0xC6, 0x31, 0x8C, 0x3E, 0x18,
+  0xC6, 0x31, 0x8C, 0x63, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x18, 0xC6, 0x31, 0x8C, 0x63,
+  0x0F, 0xC0, 0x30, 0x0C, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x07, 0x00, 0xC0, 0x30, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x80,
+  0xC0, 0x60, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
+  0x61, 0x80, 0x60, 0x30, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1,
+  0x8C, 0xC1, 0xB0, 0x6C, 0xFB, 0x66, 0xD9, 0xB6, 0x6D, 0x9B, 0x3E, 0xC0,
+  0x30, 0x06, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1C, 0x0F, 0x86, 0x31, 0x8C, 0x63, 0x1F, 0xC6, 0x31, 0x8C,
+  0x63, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7E, 0x18, 0xC6, 0x31, 0x8C, 0x7E, 0x18, 0xC6, 0x31,
+  0x8C, 0x63, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0x0C, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x30, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x19, 0x86, 0x31, 0x8C, 0x63, 0x18,
+  0xC6, 0x31, 0x8C, 0x66, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x18, 0x06, 0x01, 0x80, 0x7E,
+  0x18, 0x06, 0x01, 0x80, 0x60, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x18, 0x06, 0x01, 0x80,
+  0x7E, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x0C, 0x06, 0x01,
+  0x80, 0x60, 0x19, 0xC6, 0x31, 0x8C, 0x33, 0x07, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x18, 0xC6,
+  0x31, 0x8C, 0x7F, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x83,
+  0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x1F, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC6, 0x31, 0x8C, 0x63, 0x0F, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x98, 0xC6, 0x61, 0xB0, 0x78, 0x1E, 0x06, 0xC1, 0x98, 0x63, 0x18,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
+  0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x61, 0x9C, 0xE7, 0xF9, 0xB6, 0x61, 0x98, 0x66, 0x19, 0x86,
+  0x61, 0x98, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x61, 0x9C, 0x67, 0x99, 0xB6, 0x67, 0x98, 0xE6, 0x19,
+  0x86, 0x61, 0x98, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1E, 0x0C, 0xC6, 0x19, 0x86, 0x61, 0x98, 0x66,
+  0x19, 0x86, 0x33, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x1F,
+  0x86, 0x01, 0x80, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0C, 0xC6, 0x19, 0x86, 0x61,
+  0x98, 0x66, 0x19, 0x86, 0x33, 0x07, 0x80, 0x60, 0x0E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x18, 0xC6, 0x31, 0x8C,
+  0x63, 0x1F, 0x86, 0xC1, 0x98, 0x63, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x18, 0xC6, 0x01,
+  0x80, 0x38, 0x03, 0x80, 0x30, 0x0C, 0x63, 0x0F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x83, 0x00,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x18,
+  0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x0F, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63,
+  0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC3, 0x60, 0xD8, 0x1C, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9B, 0x66, 0xD9, 0xFE, 0x73, 0x98,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x63, 0x18, 0xC6, 0x30, 0xD8, 0x1C, 0x07, 0x03, 0x61, 0x8C, 0x63,
+  0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x61, 0x98, 0x66, 0x18, 0xCC, 0x1E, 0x03, 0x00, 0xC0, 0x30,
+  0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0x00, 0xC0, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01,
+  0x80, 0x60, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFC, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+  0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x01, 0x80, 0x30, 0x0C, 0x01, 0x80, 0x60, 0x0C, 0x03,
+  0x00, 0x60, 0x18, 0x03, 0x00, 0xC0, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x7E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1C, 0x0D, 0x86, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xE0, 0x0C, 0x03, 0x0F, 0xC6, 0x31, 0x8C, 0x67, 0x0E, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x60,
+  0x18, 0x06, 0xE1, 0xCC, 0x61, 0x98, 0x66, 0x19, 0x86, 0x63, 0x1F, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xE0, 0xCC, 0x60, 0x18, 0x06, 0x01, 0x80, 0x33, 0x07,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x01, 0x80, 0x61, 0xF8, 0xC6, 0x61, 0x98, 0x66, 0x19, 0x86, 0x33,
+  0x87, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0xCC, 0x63, 0x1F, 0xC6, 0x01, 0x80,
+  0x30, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF0, 0x60, 0x18, 0x06, 0x07, 0xF0, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEC, 0xCE, 0x61, 0x98, 0x63,
+  0x30, 0x78, 0x30, 0x0F, 0xC6, 0x19, 0x86, 0x3F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x60, 0x18, 0x06, 0xE1, 0xCC, 0x63, 0x18,
+  0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x07, 0xC0, 0x30, 0x0C,
+  0x03, 0x00, 0xC0, 0x30, 0x0C, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00, 0x03, 0xE0, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x30, 0x78, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x31,
+  0x98, 0x6C, 0x1E, 0x07, 0xC1, 0x98, 0x63, 0x18, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x0C, 0x03, 0x00,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x01, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xF1, 0xB6, 0x6D, 0x9B, 0x66, 0xD9, 0xB6, 0x6D, 0x9B, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xE1, 0xCC, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xE0, 0xCC, 0x61, 0x98, 0x66, 0x19, 0x86, 0x33, 0x07,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xE1, 0xCC, 0x61, 0x98, 0x66, 0x19, 0x86, 0x63,
+  0x1F, 0x86, 0x01, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xC6, 0x61, 0x98, 0x66, 0x19, 0x86,
+  0x33, 0x87, 0x60, 0x18, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE1, 0xCC, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0x8C, 0x60, 0x0E, 0x00,
+  0xE0, 0x0C, 0x63, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x07, 0xF0, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x60, 0x18, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x31, 0x8C, 0x63,
+  0x18, 0xC6, 0x31, 0x8C, 0x67, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x31, 0x8C,
+  0x63, 0x18, 0xC3, 0x60, 0xD8, 0x1C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x19,
+  0x86, 0x61, 0x9B, 0x66, 0xD9, 0xB6, 0x6D, 0x8F, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0x31, 0x8C, 0x36, 0x07, 0x01, 0xC0, 0xD8, 0x63, 0x18, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x30, 0xDC, 0x1F, 0x00, 0xC0, 0x30,
+  0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xF0, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x1F, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x30,
+  0x0C, 0x03, 0x00, 0xC0, 0x30, 0x18, 0x1C, 0x01, 0x80, 0x30, 0x0C, 0x03,
+  0x00, 0xC0, 0x30, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x80, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x06, 0x00, 0xE0, 0x60, 0x30,
+  0x0C, 0x03, 0x00, 0xC0, 0x30, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x8C, 0xF3, 0x33, 0xCC, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const GFXglyph Tamzen20x1BoldGlyphs[] PROGMEM = {
+  {     0,  10,  20,  10,    0,  -14 },  // 0x20 ' '
+  {    25,  10,  20,  10,    0,  -14 },  // 0x21 '!'
+  {    50,  10,  20,  10,    0,  -14 },  // 0x22 '"'
+  {    75,  10,  20,  10,    0,  -14 },  // 0x23 '#'
+  {   100,  10,  20,  10,    0,  -14 },  // 0x24 '$'
+  {   125,  10,  20,  10,    0,  -14 },  // 0x25 '%'
+  {   150,  10,  20,  10,    0,  -14 },  // 0x26 '&'
+  {   175,  10,  20,  10,    0,  -14 },  // 0x27 '''
+  {   200,  10,  20,  10,    0,  -14 },  // 0x28 '('
+  {   225,  10,  20,  10,    0,  -14 },  // 0x29 ')'
+  {   250,  10,  20,  10,    0,  -14 },  // 0x2A '*'
+  {   275,  10,  20,  10,    0,  -14 },  // 0x2B '+'
+  {   300,  10,  20,  10,    0,  -14 },  // 0x2C ','
+  {   325,  10,  20,  10,    0,  -14 },  // 0x2D '-'
+  {   350,  10,  20,  10,    0,  -14 },  // 0x2E '.'
+  {   375,  10,  20,  10,    0,  -14 },  // 0x2F '/'
+  {   400,  10,  20,  10,    0,  -14 },  // 0x30 '0'
+  {   425,  10,  20,  10,    0,  -14 },  // 0x31 '1'
+  {   450,  10,  20,  10,    0,  -14 },  // 0x32 '2'
+  {   475,  10,  20,  10,    0,  -14 },  // 0x33 '3'
+  {   500,  10,  20,  10,    0,  -14 },  // 0x34 '4'
+  {   525,  10,  20,  10,    0,  -14 },  // 0x35 '5'
+  {   550,  10,  20,  10,    0,  -14 },  // 0x36 '6'
+  {   575,  10,  20,  10,    0,  -14 },  // 0x37 '7'
+  {   600,  10,  20,  10,    0,  -14 },  // 0x38 '8'
+  {   625,  10,  20,  10,    0,  -14 },  // 0x39 '9'
+  {   650,  10,  20,  10,    0,  -14 },  // 0x3A ':'
+  {   675,  10,  20,  10,    0,  -14 },  // 0x3B ';'
+  {   700,  10,  20,  10,    0,  -14 },  // 0x3C '<'
+  {   725,  10,  20,  10,    0,  -14 },  // 0x3D '='
+  {   750,  10,  20,  10,    0,  -14 },  // 0x3E '>'
+  {   775,  10,  20,  10,    0,  -14 },  // 0x3F '?'
+  {   800,  10,  20,  10,    0,  -14 },  // 0x40 '@'
+  {   825,  10,  20,  10,    0,  -14 },  // 0x41 'A'
+  {   850,  10,  20,  10,    0,  -14 },  // 0x42 'B'
+  {   875,  10,  20,  10,    0,  -14 },  // 0x43 'C'
+  {   900,  10,  20,  10,    0,  -14 },  // 0x44 'D'
+  {   925,  10,  20,  10,    0,  -14 },  // 0x45 'E'
+  {   950,  10,  20,  10,    0,  -14 },  // 0x46 'F'
+  {   975,  10,  20,  10,    0,  -14 },  // 0x47 'G'
+  {  1000,  10,  20,  10,    0,  -14 },  // 0x48 'H'
+  {  1025,  10,  20,  10,    0,  -14 },  // 0x49 'I'
+  {  1050,  10,  20,  10,    0,  -14 },  // 0x4A 'J'
+  {  1075,  10,  20,  10,    0,  -14 },  // 0x4B 'K'
+  {  1100,  10,  20,  10,    0,  -14 },  // 0x4C 'L'
+  {  1125,  10,  20,  10,    0,  -14 },  // 0x4D 'M'
+  {  1150,  10,  20,  10,    0,  -14 },  // 0x4E 'N'
+  {  1175,  10,  20,  10,    0,  -14 },  // 0x4F 'O'
+  {  1200,  10,  20,  10,    0,  -14 },  // 0x50 'P'
+  {  1225,  10,  20,  10,    0,  -14 },  // 0x51 'Q'
+  {  1250,  10,  20,  10,    0,  -14 },  // 0x52 'R'
+  {  1275,  10,  20,  10,    0,  -14 },  // 0x53 'S'
+  {  1300,  10,  20,  10,    0,  -14 },  // 0x54 'T'
+  {  1325,  10,  20,  10,    0,  -14 },  // 0x55 'U'
+  {  1350,  10,  20,  10,    0,  -14 },  // 0x56 'V'
+  {  1375,  10,  20,  10,    0,  -14 },  // 0x57 'W'
+  {  1400,  10,  20,  10,    0,  -14 },  // 0x58 'X'
+  {  1425,  10,  20,  10,    0,  -14 },  // 0x59 'Y'
+  {  1450,  10,  20,  10,    0,  -14 },  // 0x5A 'Z'
+  {  1475,  10,  20,  10,    0,  -14 },  // 0x5B '['
+  {  1500,  10,  20,  10,    0,  -14 },  // 0x5C '\'
+  {  1525,  10,  20,  10,    0,  -14 },  // 0x5D ']'
+  {  1550,  10,  20,  10,    0,  -14 },  // 0x5E '^'
+  {  1575,  10,  20,  10,    0,  -14 },  // 0x5F '_'
+  {  1600,  10,  20,  10,    0,  -14 },  // 0x60 '`'
+  {  1625,  10,  20,  10,    0,  -14 },  // 0x61 'a'
+  {  1650,  10,  20,  10,    0,  -14 },  // 0x62 'b'
+  {  1675,  10,  20,  10,    0,  -14 },  // 0x63 'c'
+  {  1700,  10,  20,  10,    0,  -14 },  // 0x64 'd'
+  {  1725,  10,  20,  10,    0,  -14 },  // 0x65 'e'
+  {  1750,  10,  20,  10,    0,  -14 },  // 0x66 'f'
+  {  1775,  10,  20,  10,    0,  -14 },  // 0x67 'g'
+  {  1800,  10,  20,  10,    0,  -14 },  // 0x68 'h'
+  {  1825,  10,  20,  10,    0,  -14 },  // 0x69 'i'
+  {  1850,  10,  20,  10,    0,  -14 },  // 0x6A 'j'
+  {  1875,  10,  20,  10,    0,  -14 },  // 0x6B 'k'
+  {  1900,  10,  20,  10,    0,  -14 },  // 0x6C 'l'
+  {  1925,  10,  20,  10,    0,  -14 },  // 0x6D 'm'
+  {  1950,  10,  20,  10,    0,  -14 },  // 0x6E 'n'
+  {  1975,  10,  20,  10,    0,  -14 },  // 0x6F 'o'
+  {  2000,  10,  20,  10,    0,  -14 },  // 0x70 'p'
+  {  2025,  10,  20,  10,    0,  -14 },  // 0x71 'q'
+  {  2050,  10,  20,  10,    0,  -14 },  // 0x72 'r'
+  {  2075,  10,  20,  10,    0,  -14 },  // 0x73 's'
+  {  2100,  10,  20,  10,    0,  -14 },  // 0x74 't'
+  {  2125,  10,  20,  10,    0,  -14 },  // 0x75 'u'
+  {  2150,  10,  20,  10,    0,  -14 },  // 0x76 'v'
+  {  2175,  10,  20,  10,    0,  -14 },  // 0x77 'w'
+  {  2200,  10,  20,  10,    0,  -14 },  // 0x78 'x'
+  {  2225,  10,  20,  10,    0,  -14 },  // 0x79 'y'
+  {  2250,  10,  20,  10,    0,  -14 },  // 0x7A 'z'
+  {  2275,  10,  20,  10,    0,  -14 },  // 0x7B '{'
+  {  2300,  10,  20,  10,    0,  -14 },  // 0x7C '|'
+  {  2325,  10,  20,  10,    0,  -14 },  // 0x7D '}'
+  {  2350,  10,  20,  10,    0,  -14 },  // 0x7E '~'
+};
+
+const GFXfont Tamzen20x1Bold PROGMEM = {
+  (uint8_t  *)Tamzen20x1BoldBitmaps,
+  (GFXglyph *)Tamzen20x1BoldGlyphs,
+  0x20, 0x7E, 20
+};
+
+constexpr uint8_t Tamzen20x1BoldAdvance[] = {
+   10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+   10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+   10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+   10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+   10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+   10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+};
+
+constexpr GFXMetrics Tamzen20x1BoldMetrics = {
+  14, 6, 20, 1, 0x20, 0x7E, Tamzen20x1BoldAdvance
+};
+
+#endif // TAMZEN20X1BOLD_H
@@ -2,477 +2,27 @@
 #define TAMZEN26X2BOLD_H
 
 #include <Adafruit_GFX.h>
+#include "GFXMetrics.h"
+#include "Tamzen13x1Bold.h"
 
-const uint8_t Tamzen26x2BoldBitmaps[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x03, 0xFC, 0x0F, 0xF0,
-  0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3,
-  0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x0C,
-  0x30, 0x30, 0xC0, 0xC3, 0x0F, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3, 0xFF, 0xC3,
-  0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x0F, 0xFF, 0x3F, 0xFC, 0xFF, 0xF3,
-  0xFF, 0xC3, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x03,
-  0xC0, 0x0F, 0x00, 0xFF, 0x03, 0xFC, 0x3C, 0x00, 0xF0, 0x00, 0xF0, 0x03,
-  0xC0, 0x03, 0xC0, 0x0F, 0x00, 0x0F, 0x00, 0x3C, 0x3F, 0xC0, 0xFF, 0x00,
-  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xF0,
-  0x0F, 0x30, 0x3C, 0xC0, 0xF3, 0xF3, 0xCF, 0xC3, 0xFC, 0x0F, 0xF0, 0x0F,
-  0x00, 0x3C, 0x03, 0xFC, 0x0F, 0xF0, 0xFF, 0x33, 0xFC, 0xC0, 0xF3, 0x03,
-  0xCC, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x0F, 0x3C,
-  0x3C, 0xF0, 0xF3, 0xC3, 0xCF, 0x03, 0xF0, 0x0F, 0xC0, 0xF3, 0xFF, 0xCF,
-  0xFF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xC3, 0xFF, 0xCF, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
-  0x0F, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
-  0x3C, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
-  0x3C, 0x00, 0xF0, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0x3C,
-  0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3C, 0x00, 0xF0, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
-  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
-  0x0F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x03, 0xC0, 0x0F, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xF0, 0xF3, 0xC0, 0xFC, 0x03,
-  0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x03, 0xF0, 0x3C, 0xF0, 0xF3, 0xC0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0xFF,
-  0xF3, 0xFF, 0xC0, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x0F,
-  0x00, 0x3C, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0xFF, 0xC0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
-  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
-  0xF0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0xF0, 0xF3, 0xC3, 0xCF, 0x3F, 0x3C,
-  0xFC, 0xFC, 0xF3, 0xF3, 0xCF, 0xCF, 0x3F, 0x3C, 0xF0, 0xF3, 0xC3, 0xC3,
-  0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xF0, 0x03, 0xC0, 0x3F, 0x00, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F,
-  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x0F, 0xFF, 0x3F,
-  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-  0x0F, 0xF0, 0xF0, 0xF3, 0xC3, 0xC0, 0x0F, 0x00, 0x3C, 0x03, 0xC0, 0x0F,
-  0x00, 0xF0, 0x03, 0xC0, 0x3C, 0x00, 0xF0, 0x0F, 0xFF, 0x3F, 0xFC, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x3F, 0xFC,
-  0x00, 0xF0, 0x03, 0xC0, 0x3C, 0x00, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0x0F,
-  0x00, 0x3C, 0xF0, 0xF3, 0xC3, 0xC3, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x0F, 0xC0,
-  0x3F, 0x03, 0xFC, 0x0F, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0xFF, 0x3F, 0xFC,
-  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x3F, 0xFC, 0xF0, 0x03, 0xC0, 0x0F,
-  0xFC, 0x3F, 0xF0, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0xF0, 0xF3,
-  0xC3, 0xC3, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x3C, 0x00, 0xF0, 0x0F, 0x00, 0x3C,
-  0x00, 0xFF, 0xC3, 0xFF, 0x0F, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xC3,
-  0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0F, 0xFF, 0x3F, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x3C, 0x00, 0xF0, 0x03,
-  0xC0, 0x0F, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
-  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-  0x0F, 0xF0, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0x3F, 0xC0, 0xFF,
-  0x0F, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xC3, 0xFC, 0x0F, 0xF0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0,
-  0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0x3F, 0xF0, 0xFF, 0xC0, 0x0F,
-  0x00, 0x3C, 0x03, 0xC0, 0x0F, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-  0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x03,
-  0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-  0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0x00, 0x3C, 0x03, 0xC0, 0x0F, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x03, 0xC0, 0x0F, 0x00, 0xF0, 0x03,
-  0xC0, 0x3C, 0x00, 0xF0, 0x00, 0xF0, 0x03, 0xC0, 0x03, 0xC0, 0x0F, 0x00,
-  0x0F, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x3F, 0xFC, 0x00,
-  0x00, 0x00, 0x0F, 0xFF, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-  0x3C, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xF0, 0x03, 0xC0, 0x03, 0xC0, 0x0F,
-  0x00, 0xF0, 0x03, 0xC0, 0x3C, 0x00, 0xF0, 0x0F, 0x00, 0x3C, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x0F, 0x0F, 0x3C, 0x3C,
-  0x00, 0xF0, 0x03, 0xC0, 0x3C, 0x00, 0xF0, 0x0F, 0x00, 0x3C, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x0F, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3,
-  0xC3, 0xCF, 0x3F, 0x3C, 0xFC, 0xF3, 0xF3, 0xCF, 0xCF, 0x3F, 0x3C, 0xFC,
-  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x3F, 0xC0, 0xFF, 0x0F,
-  0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF, 0xFF, 0x3F, 0xFC, 0xF0, 0xF3,
-  0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C,
-  0x3C, 0xFF, 0xC3, 0xFF, 0x0F, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF,
-  0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0x03, 0xFC, 0x3C, 0x00, 0xF0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
-  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xFF, 0x03,
-  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-  0x3F, 0xC0, 0xF3, 0xC3, 0xCF, 0x0F, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3,
-  0xCF, 0x0F, 0x3C, 0x3C, 0xF3, 0xC3, 0xCF, 0x0F, 0xF0, 0x3F, 0xC0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x3F, 0xFC,
-  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xFF, 0xC3, 0xFF, 0x0F, 0x00,
-  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0xFF, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x3F, 0xFC, 0xF0, 0x03,
-  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xFF, 0xC3, 0xFF, 0x0F, 0x00, 0x3C, 0x00,
-  0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x3C, 0x00, 0xF0, 0x0F,
-  0x00, 0x3C, 0x00, 0xF3, 0xF3, 0xCF, 0xCF, 0x0F, 0x3C, 0x3C, 0x3C, 0xF0,
-  0xF3, 0xC0, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C,
-  0x3C, 0xFF, 0xF3, 0xFF, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF,
-  0x0F, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0F, 0xFF, 0x3F, 0xFC, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
-  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x0F, 0xFF, 0x3F,
-  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
-  0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xC3, 0xFC, 0x0F, 0xF0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x3C, 0x3C,
-  0xF3, 0xC3, 0xCF, 0x0F, 0xF0, 0x3F, 0xC0, 0xFC, 0x03, 0xF0, 0x0F, 0xF0,
-  0x3F, 0xC0, 0xF3, 0xC3, 0xCF, 0x0F, 0x0F, 0x3C, 0x3C, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
-  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
-  0xF0, 0x03, 0xC0, 0x0F, 0xFF, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x3C, 0x3C, 0xFF, 0xF3, 0xFF, 0xCF,
-  0xFF, 0x3F, 0xFC, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3,
-  0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0x0F, 0x3C, 0x3C, 0xFC, 0xF3, 0xF3, 0xCF, 0xFF, 0x3F,
-  0xFC, 0xF3, 0xF3, 0xCF, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF,
-  0x0F, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0xFC, 0x0F, 0xF0, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0,
-  0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xC3, 0xFC, 0x0F,
-  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-  0x3F, 0xF0, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xFF, 0xC3, 0xFF,
-  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0,
-  0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F,
-  0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xC3, 0xFC, 0x0F, 0xF0, 0x03, 0xC0, 0x0F,
-  0x00, 0x0F, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0xF0, 0xF3,
-  0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xFF, 0xC3, 0xFF, 0x0F, 0x3C, 0x3C, 0xF0,
-  0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0xF0, 0x03, 0xC0, 0x0F,
-  0x00, 0x3C, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
-  0x03, 0xCF, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0xFF, 0x3F, 0xFC, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
-  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
-  0xF0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0F, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0,
-  0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xC3, 0xFC, 0x0F,
-  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F,
-  0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3,
-  0xCF, 0x0F, 0x3C, 0x3C, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x03, 0xC0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x3C, 0x3C,
-  0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF, 0xFF,
-  0x3F, 0xFC, 0xFF, 0xF3, 0xFF, 0xCF, 0x0F, 0x3C, 0x3C, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3,
-  0xC3, 0xC3, 0xFC, 0x0F, 0xF0, 0x0F, 0x00, 0x3C, 0x03, 0xFC, 0x0F, 0xF0,
-  0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xC3,
-  0xFC, 0x0F, 0xF0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
-  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0xFF, 0x3F, 0xFC, 0x03, 0xC0, 0x0F, 0x00, 0xF0, 0x03,
-  0xC0, 0x0F, 0x00, 0x3C, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x0F,
-  0xFF, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF,
-  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
-  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
-  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
-  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0xF0, 0x03,
-  0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x3C, 0x00, 0xF0,
-  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
-  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
-  0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x3F, 0xC0,
-  0xFF, 0x0F, 0x0F, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-  0x00, 0xF0, 0x00, 0xF0, 0x03, 0xC0, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00,
-  0xF0, 0x03, 0xC3, 0xFF, 0x0F, 0xFC, 0xF0, 0xF3, 0xC3, 0xC3, 0xFF, 0x0F,
-  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0xFC, 0x3F, 0xF0, 0xF0, 0xF3, 0xC3,
-  0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF, 0xFC, 0x3F, 0xF0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
-  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
-  0x03, 0xC3, 0xFF, 0x0F, 0xFC, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C,
-  0xF0, 0xF3, 0xC3, 0xC3, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0xFC, 0x0F, 0xF0, 0xF0, 0xF3, 0xC3, 0xCF, 0xFF, 0x3F, 0xFC, 0xF0, 0x03,
-  0xC0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x3C, 0x00, 0xF0, 0x0F, 0xFF, 0x3F,
-  0xFC, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
-  0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0xF0,
-  0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xC3, 0xFF, 0x0F,
-  0xFC, 0x00, 0xF0, 0x03, 0xC3, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0xFC, 0x3F, 0xF0, 0xF0, 0xF3, 0xC3,
-  0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xC0,
-  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
-  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x0F, 0xFF, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00,
-  0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
-  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x0F, 0xF0,
-  0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
-  0x3C, 0x3C, 0xF0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xF3, 0xC3,
-  0xCF, 0x0F, 0x0F, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
-  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x0F,
-  0xFF, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x3F, 0xFC, 0xF3,
-  0x33, 0xCC, 0xCF, 0x33, 0x3C, 0xCC, 0xF3, 0x33, 0xCC, 0xCF, 0x33, 0x3C,
-  0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0xF0, 0xF3, 0xC3,
-  0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F,
-  0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xC3, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C,
-  0xF0, 0xF3, 0xC3, 0xCF, 0xFC, 0x3F, 0xF0, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
-  0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0xFF, 0x0F, 0xFC, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3,
-  0xC3, 0xC3, 0xFF, 0x0F, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x3C,
-  0xFC, 0xFC, 0x03, 0xF0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
-  0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0xF0,
-  0x03, 0xC0, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0xF0, 0x03, 0xCF, 0xFC, 0x3F,
-  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3C, 0x00, 0xF0, 0x0F, 0xFF, 0x3F, 0xFC, 0x3C, 0x00, 0xF0,
-  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xFF, 0x03, 0xFC, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0F, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F,
-  0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xC3, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0F, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C,
-  0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-  0x03, 0x3C, 0x0C, 0xF3, 0x33, 0xCC, 0xCF, 0x33, 0x3C, 0xCC, 0xFF, 0xF3,
-  0xFF, 0xCF, 0xCF, 0x3F, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x3C,
-  0x3C, 0x3F, 0xC0, 0xFF, 0x00, 0xF0, 0x03, 0xC0, 0x3F, 0xC0, 0xFF, 0x0F,
-  0x0F, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x3C, 0x3C, 0xF0,
-  0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF3, 0xC3, 0xC3, 0xFF, 0x0F,
-  0xFC, 0x00, 0xF0, 0x03, 0xC3, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x3F, 0xFC, 0x03, 0xC0, 0x0F,
-  0x00, 0xF0, 0x03, 0xC0, 0x3C, 0x00, 0xF0, 0x0F, 0xFF, 0x3F, 0xFC, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0x00, 0xFC, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
-  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0xFC, 0x03, 0xF0, 0x00, 0xF0,
-  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
-  0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
-  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
-  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-  0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
-  0xF0, 0x03, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
-  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x0F, 0xC0, 0x3F, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0xC3, 0x0F, 0x0C, 0xFF, 0xF3, 0xFF, 0xCC, 0x3C, 0x30,
-  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00,
+// 2x: drawn by expanding each glyph pixel to 2x2
+const GFXfont Tamzen26x2Bold PROGMEM = {
+  (uint8_t  *)Tamzen13x1BoldBitmaps,
+  (GFXglyph *)Tamzen13x1BoldGlyphs,
+  0x20, 0x7E, 26
 };
 
-const GFXglyph Tamzen26x2BoldGlyphs[] PROGMEM = {
-  {     0,  14,  26,  14,    0,  -22 },  // 0x20 ' '
-  {    46,  14,  26,  14,    0,  -22 },  // 0x21 '!'
-  {    92,  14,  26,  14,    0,  -22 },  // 0x22 '"'
-  {   138,  14,  26,  14,    0,  -22 },  // 0x23 '#'
-  {   184,  14,  26,  14,    0,  -22 },  // 0x24 '$'
-  {   230,  14,  26,  14,    0,  -22 },  // 0x25 '%'
-  {   276,  14,  26,  14,    0,  -22 },  // 0x26 '&'
-  {   322,  14,  26,  14,    0,  -22 },  // 0x27 '''
-  {   368,  14,  26,  14,    0,  -22 },  // 0x28 '('
-  {   414,  14,  26,  14,    0,  -22 },  // 0x29 ')'
-  {   460,  14,  26,  14,    0,  -22 },  // 0x2A '*'
-  {   506,  14,  26,  14,    0,  -22 },  // 0x2B '+'
-  {   552,  14,  26,  14,    0,  -22 },  // 0x2C ','
-  {   598,  14,  26,  14,    0,  -22 },  // 0x2D '-'
-  {   644,  14,  26,  14,    0,  -22 },  // 0x2E '.'
-  {   690,  14,  26,  14,    0,  -22 },  // 0x2F '/'
-  {   736,  14,  26,  14,    0,  -22 },  // 0x30 '0'
-  {   782,  14,  26,  14,    0,  -22 },  // 0x31 '1'
-  {   828,  14,  26,  14,    0,  -22 },  // 0x32 '2'
-  {   874,  14,  26,  14,    0,  -22 },  // 0x33 '3'
-  {   920,  14,  26,  14,    0,  -22 },  // 0x34 '4'
-  {   966,  14,  26,  14,    0,  -22 },  // 0x35 '5'
-  {  1012,  14,  26,  14,    0,  -22 },  // 0x36 '6'
-  {  1058,  14,  26,  14,    0,  -22 },  // 0x37 '7'
-  {  1104,  14,  26,  14,    0,  -22 },  // 0x38 '8'
-  {  1150,  14,  26,  14,    0,  -22 },  // 0x39 '9'
-  {  1196,  14,  26,  14,    0,  -22 },  // 0x3A ':'
-  {  1242,  14,  26,  14,    0,  -22 },  // 0x3B ';'
-  {  1288,  14,  26,  14,    0,  -22 },  // 0x3C '<'
-  {  1334,  14,  26,  14,    0,  -22 },  // 0x3D '='
-  {  1380,  14,  26,  14,    0,  -22 },  // 0x3E '>'
-  {  1426,  14,  26,  14,    0,  -22 },  // 0x3F '?'
-  {  1472,  14,  26,  14,    0,  -22 },  // 0x40 '@'
-  {  1518,  14,  26,  14,    0,  -22 },  // 0x41 'A'
-  {  1564,  14,  26,  14,    0,  -22 },  // 0x42 'B'
-  {  1610,  14,  26,  14,    0,  -22 },  // 0x43 'C'
-  {  1656,  14,  26,  14,    0,  -22 },  // 0x44 'D'
-  {  1702,  14,  26,  14,    0,  -22 },  // 0x45 'E'
-  {  1748,  14,  26,  14,    0,  -22 },  // 0x46 'F'
-  {  1794,  14,  26,  14,    0,  -22 },  // 0x47 'G'
-  {  1840,  14,  26,  14,    0,  -22 },  // 0x48 'H'
-  {  1886,  14,  26,  14,    0,  -22 },  // 0x49 'I'
-  {  1932,  14,  26,  14,    0,  -22 },  // 0x4A 'J'
-  {  1978,  14,  26,  14,    0,  -22 },  // 0x4B 'K'
-  {  2024,  14,  26,  14,    0,  -22 },  // 0x4C 'L'
-  {  2070,  14,  26,  14,    0,  -22 },  // 0x4D 'M'
-  {  2116,  14,  26,  14,    0,  -22 },  // 0x4E 'N'
-  {  2162,  14,  26,  14,    0,  -22 },  // 0x4F 'O'
-  {  2208,  14,  26,  14,    0,  -22 },  // 0x50 'P'
-  {  2254,  14,  26,  14,    0,  -22 },  // 0x51 'Q'
-  {  2300,  14,  26,  14,    0,  -22 },  // 0x52 'R'
-  {  2346,  14,  26,  14,    0,  -22 },  // 0x53 'S'
-  {  2392,  14,  26,  14,    0,  -22 },  // 0x54 'T'
-  {  2438,  14,  26,  14,    0,  -22 },  // 0x55 'U'
-  {  2484,  14,  26,  14,    0,  -22 },  // 0x56 'V'
-  {  2530,  14,  26,  14,    0,  -22 },  // 0x57 'W'
-  {  2576,  14,  26,  14,    0,  -22 },  // 0x58 'X'
-  {  2622,  14,  26,  14,    0,  -22 },  // 0x59 'Y'
-  {  2668,  14,  26,  14,    0,  -22 },  // 0x5A 'Z'
-  {  2714,  14,  26,  14,    0,  -22 },  // 0x5B '['
-  {  2760,  14,  26,  14,    0,  -22 },  // 0x5C '\'
-  {  2806,  14,  26,  14,    0,  -22 },  // 0x5D ']'
-  {  2852,  14,  26,  14,    0,  -22 },  // 0x5E '^'
-  {  2898,  14,  26,  14,    0,  -22 },  // 0x5F '_'
-  {  2944,  14,  26,  14,    0,  -22 },  // 0x60 '`'
-  {  2990,  14,  26,  14,    0,  -22 },  // 0x61 'a'
-  {  3036,  14,  26,  14,    0,  -22 },  // 0x62 'b'
-  {  3082,  14,  26,  14,    0,  -22 },  // 0x63 'c'
-  {  3128,  14,  26,  14,    0,  -22 },  // 0x64 'd'
-  {  3174,  14,  26,  14,    0,  -22 },  // 0x65 'e'
-  {  3220,  14,  26,  14,    0,  -22 },  // 0x66 'f'
-  {  3266,  14,  26,  14,    0,  -22 },  // 0x67 'g'
-  {  3312,  14,  26,  14,    0,  -22 },  // 0x68 'h'
-  {  3358,  14,  26,  14,    0,  -22 },  // 0x69 'i'
-  {  3404,  14,  26,  14,    0,  -22 },  // 0x6A 'j'
-  {  3450,  14,  26,  14,    0,  -22 },  // 0x6B 'k'
-  {  3496,  14,  26,  14,    0,  -22 },  // 0x6C 'l'
-  {  3542,  14,  26,  14,    0,  -22 },  // 0x6D 'm'
-  {  3588,  14,  26,  14,    0,  -22 },  // 0x6E 'n'
-  {  3634,  14,  26,  14,    0,  -22 },  // 0x6F 'o'
-  {  3680,  14,  26,  14,    0,  -22 },  // 0x70 'p'
-  {  3726,  14,  26,  14,    0,  -22 },  // 0x71 'q'
-  {  3772,  14,  26,  14,    0,  -22 },  // 0x72 'r'
-  {  3818,  14,  26,  14,    0,  -22 },  // 0x73 's'
-  {  3864,  14,  26,  14,    0,  -22 },  // 0x74 't'
-  {  3910,  14,  26,  14,    0,  -22 },  // 0x75 'u'
-  {  3956,  14,  26,  14,    0,  -22 },  // 0x76 'v'
-  {  4002,  14,  26,  14,    0,  -22 },  // 0x77 'w'
-  {  4048,  14,  26,  14,    0,  -22 },  // 0x78 'x'
-  {  4094,  14,  26,  14,    0,  -22 },  // 0x79 'y'
-  {  4140,  14,  26,  14,    0,  -22 },  // 0x7A 'z'
-  {  4186,  14,  26,  14,    0,  -22 },  // 0x7B '{'
-  {  4232,  14,  26,  14,    0,  -22 },  // 0x7C '|'
-  {  4278,  14,  26,  14,    0,  -22 },  // 0x7D '}'
-  {  4324,  14,  26,  14,    0,  -22 },  // 0x7E '~'
+constexpr uint8_t Tamzen26x2BoldAdvance[] = {
+   14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,
+   14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,
+   14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,
+   14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,
+   14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,
+   14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,
 };
 
-const GFXfont Tamzen26x2Bold PROGMEM = {
-  (uint8_t  *)Tamzen26x2BoldBitmaps,
-  (GFXglyph *)Tamzen26x2BoldGlyphs,
-  0x20, 0x7E, 26
+constexpr GFXMetrics Tamzen26x2BoldMetrics = {
+  22, 4, 26, 2, 0x20, 0x7E, Tamzen26x2BoldAdvance
 };
 
 #endif // TAMZEN26X2BOLD_H
@@ -3,129 +3,724 @@
 
 #include <Adafruit_GFX.h>
 
+// Per-watch font subset. api/build_firmware.php defines
+// CRISPFACE_FONT_SUBSET plus CRISPFACE_FONT_<name> in config.h for each font
+// the watch's faces use; a plain build links everything. FreeSans 9, 12
+// and 24pt are always linked for the firmware's own screens.
+#ifndef CRISPFACE_FONT_SUBSET
+#define CRISPFACE_FONT_FreeSans9pt7b
+#define CRISPFACE_FONT_FreeSans12pt7b
+#define CRISPFACE_FONT_FreeSans18pt7b
+#define CRISPFACE_FONT_FreeSans24pt7b
+#define CRISPFACE_FONT_FreeSans36pt7b
+#define CRISPFACE_FONT_FreeSans48pt7b
+#define CRISPFACE_FONT_FreeSansBold9pt7b
+#define CRISPFACE_FONT_FreeSansBold12pt7b
+#define CRISPFACE_FONT_FreeSansBold18pt7b
+#define CRISPFACE_FONT_FreeSansBold24pt7b
+#define CRISPFACE_FONT_FreeSansBold36pt7b
+#define CRISPFACE_FONT_FreeSansBold48pt7b
+#define CRISPFACE_FONT_FreeSerif9pt7b
+#define CRISPFACE_FONT_FreeSerif12pt7b
+#define CRISPFACE_FONT_FreeSerif18pt7b
+#define CRISPFACE_FONT_FreeSerif24pt7b
+#define CRISPFACE_FONT_FreeSerif36pt7b
+#define CRISPFACE_FONT_FreeSerif48pt7b
+#define CRISPFACE_FONT_FreeSerifBold9pt7b
+#define CRISPFACE_FONT_FreeSerifBold12pt7b
+#define CRISPFACE_FONT_FreeSerifBold18pt7b
+#define CRISPFACE_FONT_FreeSerifBold24pt7b
+#define CRISPFACE_FONT_FreeSerifBold36pt7b
+#define CRISPFACE_FONT_FreeSerifBold48pt7b
+#define CRISPFACE_FONT_Tamzen13x1
+#define CRISPFACE_FONT_Tamzen16x1
+#define CRISPFACE_FONT_Tamzen26x2
+#define CRISPFACE_FONT_Tamzen32x2
+#define CRISPFACE_FONT_Tamzen60x3
+#define CRISPFACE_FONT_Tamzen80x4
+#define CRISPFACE_FONT_Tamzen13x1Bold
+#define CRISPFACE_FONT_Tamzen16x1Bold
+#define CRISPFACE_FONT_Tamzen26x2Bold
+#define CRISPFACE_FONT_Tamzen32x2Bold
+#define CRISPFACE_FONT_Tamzen60x3Bold
+#define CRISPFACE_FONT_Tamzen80x4Bold
+#else
+#define CRISPFACE_FONT_FreeSans9pt7b
+#define CRISPFACE_FONT_FreeSans12pt7b
+#define CRISPFACE_FONT_FreeSans24pt7b
+#endif
+
 // Standard Adafruit GFX bundled fonts (9, 12, 18, 24pt)
+#ifdef CRISPFACE_FONT_FreeSans9pt7b
 #include <Fonts/FreeSans9pt7b.h>
+#endif
+#ifdef CRISPFACE_FONT_FreeSans12pt7b
 #include <Fonts/FreeSans12pt7b.h>
+#endif
+#ifdef CRISPFACE_FONT_FreeSans18pt7b
 #include <Fonts/FreeSans18pt7b.h>
+#endif
+#ifdef CRISPFACE_FONT_FreeSans24pt7b
 #include <Fonts/FreeSans24pt7b.h>
+#endif
 
+#ifdef CRISPFACE_FONT_FreeSansBold9pt7b
 #include <Fonts/FreeSansBold9pt7b.h>
+#endif
+#ifdef CRISPFACE_FONT_FreeSansBold12pt7b
 #include <Fonts/FreeSansBold12pt7b.h>
+#endif
+#ifdef CRISPFACE_FONT_FreeSansBold18pt7b
 #include <Fonts/FreeSansBold18pt7b.h>
+#endif
+#ifdef CRISPFACE_FONT_FreeSansBold24pt7b
 #include <Fonts/FreeSansBold24pt7b.h>
+#endif
+
+#ifdef CRISPFACE_FONT_FreeSerif9pt7b
+#include <Fonts/FreeSerif9pt7b.h>
+#endif
+#ifdef CRISPFACE_FONT_FreeSerif12pt7b
+#include <Fonts/FreeSerif12pt7b.h>
+#endif
+#ifdef CRISPFACE_FONT_FreeSerif18pt7b
+#include <Fonts/FreeSerif18pt7b.h>
+#endif
+#ifdef CRISPFACE_FONT_FreeSerif24pt7b
+#include <Fonts/FreeSerif24pt7b.h>
+#endif
+
+#ifdef CRISPFACE_FONT_FreeSerifBold9pt7b
+#include <Fonts/FreeSerifBold9pt7b.h>
+#endif
+#ifdef CRISPFACE_FONT_FreeSerifBold12pt7b
+#include <Fonts/FreeSerifBold12pt7b.h>
+#endif
+#ifdef CRISPFACE_FONT_FreeSerifBold18pt7b
+#include <Fonts/FreeSerifBold18pt7b.h>
+#endif
+#ifdef CRISPFACE_FONT_FreeSerifBold24pt7b
+#include <Fonts/FreeSerifBold24pt7b.h>
+#endif
 
 // Tamzen bitmap fonts (regular + bold at all sizes)
+#ifdef CRISPFACE_FONT_Tamzen13x1
 #include "crispface_fonts/Tamzen13x1.h"
+#endif
+#ifdef CRISPFACE_FONT_Tamzen13x1Bold
 #include "crispface_fonts/Tamzen13x1Bold.h"
+#endif
+#ifdef CRISPFACE_FONT_Tamzen16x1
 #include "crispface_fonts/Tamzen16x1.h"
+#endif
+#ifdef CRISPFACE_FONT_Tamzen16x1Bold
 #include "crispface_fonts/Tamzen16x1Bold.h"
+#endif
+#ifdef CRISPFACE_FONT_Tamzen26x2
 #include "crispface_fonts/Tamzen26x2.h"
+#endif
+#ifdef CRISPFACE_FONT_Tamzen26x2Bold
 #include "crispface_fonts/Tamzen26x2Bold.h"
+#endif
+#ifdef CRISPFACE_FONT_Tamzen32x2
 #include "crispface_fonts/Tamzen32x2.h"
+#endif
+#ifdef CRISPFACE_FONT_Tamzen32x2Bold
 #include "crispface_fonts/Tamzen32x2Bold.h"
+#endif
+#ifdef CRISPFACE_FONT_Tamzen60x3
 #include "crispface_fonts/Tamzen60x3.h"
+#endif
+#ifdef CRISPFACE_FONT_Tamzen60x3Bold
 #include "crispface_fonts/Tamzen60x3Bold.h"
+#endif
+#ifdef CRISPFACE_FONT_Tamzen80x4
 #include "crispface_fonts/Tamzen80x4.h"
+#endif
+#ifdef CRISPFACE_FONT_Tamzen80x4Bold
 #include "crispface_fonts/Tamzen80x4Bold.h"
+#endif
 
-#include <Fonts/FreeSerif9pt7b.h>
-#include <Fonts/FreeSerif12pt7b.h>
-#include <Fonts/FreeSerif18pt7b.h>
-#include <Fonts/FreeSerif24pt7b.h>
-
-#include <Fonts/FreeSerifBold9pt7b.h>
-#include <Fonts/FreeSerifBold12pt7b.h>
-#include <Fonts/FreeSerifBold18pt7b.h>
-#include <Fonts/FreeSerifBold24pt7b.h>
-
-// Custom 36pt + 48pt fonts generated via firmware/generate_fonts.sh
+// Custom 36pt + 48pt fonts generated via firmware/generate_fonts.sh. With
+// CRISPFACE_GLYPHS_<name> defined, build_firmware.php has written
+// <name>.subset.h, a copy holding only the glyphs the watch's faces can show
+// (tools/gfxsubset.py)
+#ifdef CRISPFACE_FONT_FreeSans36pt7b
+#ifdef CRISPFACE_GLYPHS_FreeSans36pt7b
+#include "crispface_fonts/FreeSans36pt7b.subset.h"
+#else
 #include "crispface_fonts/FreeSans36pt7b.h"
+#endif
+#endif
+#ifdef CRISPFACE_FONT_FreeSansBold36pt7b
+#ifdef CRISPFACE_GLYPHS_FreeSansBold36pt7b
+#include "crispface_fonts/FreeSansBold36pt7b.subset.h"
+#else
 #include "crispface_fonts/FreeSansBold36pt7b.h"
+#endif
+#endif
+#ifdef CRISPFACE_FONT_FreeSerif36pt7b
+#ifdef CRISPFACE_GLYPHS_FreeSerif36pt7b
+#include "crispface_fonts/FreeSerif36pt7b.subset.h"
+#else
 #include "crispface_fonts/FreeSerif36pt7b.h"
+#endif
+#endif
+#ifdef CRISPFACE_FONT_FreeSerifBold36pt7b
+#ifdef CRISPFACE_GLYPHS_FreeSerifBold36pt7b
+#include "crispface_fonts/FreeSerifBold36pt7b.subset.h"
+#else
 #include "crispface_fonts/FreeSerifBold36pt7b.h"
+#endif
+#endif
 
+#ifdef CRISPFACE_FONT_FreeSans48pt7b
+#ifdef CRISPFACE_GLYPHS_FreeSans48pt7b
+#include "crispface_fonts/FreeSans48pt7b.subset.h"
+#else
 #include "crispface_fonts/FreeSans48pt7b.h"
+#endif
+#endif
+#ifdef CRISPFACE_FONT_FreeSansBold48pt7b
+#ifdef CRISPFACE_GLYPHS_FreeSansBold48pt7b
+#include "crispface_fonts/FreeSansBold48pt7b.subset.h"
+#else
 #include "crispface_fonts/FreeSansBold48pt7b.h"
+#endif
+#endif
+#ifdef CRISPFACE_FONT_FreeSerif48pt7b
+#ifdef CRISPFACE_GLYPHS_FreeSerif48pt7b
+#include "crispface_fonts/FreeSerif48pt7b.subset.h"
+#else
 #include "crispface_fonts/FreeSerif48pt7b.h"
+#endif
+#endif
+#ifdef CRISPFACE_FONT_FreeSerifBold48pt7b
+#ifdef CRISPFACE_GLYPHS_FreeSerifBold48pt7b
+#include "crispface_fonts/FreeSerifBold48pt7b.subset.h"
+#else
 #include "crispface_fonts/FreeSerifBold48pt7b.h"
+#endif
+#endif
+
+// Oblique variants for stale text, generated per watch by build_firmware.php
+// (tools/gfxoblique.py) for the fonts its sourced complications use. Each
+// CRISPFACE_OBLIQUE_<name> links crispface_fonts/<name>Oblique.h
+#ifdef CRISPFACE_OBLIQUE_FreeSans9pt7b
+#include "crispface_fonts/FreeSans9pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSans12pt7b
+#include "crispface_fonts/FreeSans12pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSans18pt7b
+#include "crispface_fonts/FreeSans18pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSans24pt7b
+#include "crispface_fonts/FreeSans24pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSans36pt7b
+#include "crispface_fonts/FreeSans36pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSans48pt7b
+#include "crispface_fonts/FreeSans48pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSansBold9pt7b
+#include "crispface_fonts/FreeSansBold9pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSansBold12pt7b
+#include "crispface_fonts/FreeSansBold12pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSansBold18pt7b
+#include "crispface_fonts/FreeSansBold18pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSansBold24pt7b
+#include "crispface_fonts/FreeSansBold24pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSansBold36pt7b
+#include "crispface_fonts/FreeSansBold36pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSansBold48pt7b
+#include "crispface_fonts/FreeSansBold48pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerif9pt7b
+#include "crispface_fonts/FreeSerif9pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerif12pt7b
+#include "crispface_fonts/FreeSerif12pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerif18pt7b
+#include "crispface_fonts/FreeSerif18pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerif24pt7b
+#include "crispface_fonts/FreeSerif24pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerif36pt7b
+#include "crispface_fonts/FreeSerif36pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerif48pt7b
+#include "crispface_fonts/FreeSerif48pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerifBold9pt7b
+#include "crispface_fonts/FreeSerifBold9pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerifBold12pt7b
+#include "crispface_fonts/FreeSerifBold12pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerifBold18pt7b
+#include "crispface_fonts/FreeSerifBold18pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerifBold24pt7b
+#include "crispface_fonts/FreeSerifBold24pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerifBold36pt7b
+#include "crispface_fonts/FreeSerifBold36pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerifBold48pt7b
+#include "crispface_fonts/FreeSerifBold48pt7bOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen13x1
+#include "crispface_fonts/Tamzen13x1Oblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen16x1
+#include "crispface_fonts/Tamzen16x1Oblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen26x2
+#include "crispface_fonts/Tamzen26x2Oblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen32x2
+#include "crispface_fonts/Tamzen32x2Oblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen60x3
+#include "crispface_fonts/Tamzen60x3Oblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen80x4
+#include "crispface_fonts/Tamzen80x4Oblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen13x1Bold
+#include "crispface_fonts/Tamzen13x1BoldOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen16x1Bold
+#include "crispface_fonts/Tamzen16x1BoldOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen26x2Bold
+#include "crispface_fonts/Tamzen26x2BoldOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen32x2Bold
+#include "crispface_fonts/Tamzen32x2BoldOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen60x3Bold
+#include "crispface_fonts/Tamzen60x3BoldOblique.h"
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen80x4Bold
+#include "crispface_fonts/Tamzen80x4BoldOblique.h"
+#endif
 
 // Map editor stored size to Adafruit GFX pt:
 //   12 → 9pt (~13px)    16 → 12pt (~17px)
 //   24 → 18pt (~25px)   48 → 24pt (~33px)
 //   60 → 36pt (~51px)   72 → 48pt (~67px)
 
+// Font family IDs stored in compiled face records (see CfCompRec)
+enum CfFontFamily : uint8_t {
+    CF_FONT_SANS  = 0,
+    CF_FONT_SERIF = 1,
+    CF_FONT_MONO  = 2,
+};
+
+inline uint8_t fontFamilyId(const char* family) {
+    if (family[0] == 'm') return CF_FONT_MONO;                       // "mono"
+    if (family[0] == 's' && family[1] == 'e') return CF_FONT_SERIF;  // "serif" vs "sans"
+    return CF_FONT_SANS;
+}
+
+// Every linked font, by family, editor size and weight
+struct CfFontEntry {
+    uint8_t family;
+    uint8_t size;
+    bool bold;
+    const GFXfont* font;
+};
+
+static const CfFontEntry cfFonts[] = {
+#ifdef CRISPFACE_FONT_FreeSans9pt7b
+    { CF_FONT_SANS,  12, false, &FreeSans9pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSans12pt7b
+    { CF_FONT_SANS,  16, false, &FreeSans12pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSans18pt7b
+    { CF_FONT_SANS,  24, false, &FreeSans18pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSans24pt7b
+    { CF_FONT_SANS,  48, false, &FreeSans24pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSans36pt7b
+    { CF_FONT_SANS,  60, false, &FreeSans36pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSans48pt7b
+    { CF_FONT_SANS,  72, false, &FreeSans48pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSansBold9pt7b
+    { CF_FONT_SANS,  12, true,  &FreeSansBold9pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSansBold12pt7b
+    { CF_FONT_SANS,  16, true,  &FreeSansBold12pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSansBold18pt7b
+    { CF_FONT_SANS,  24, true,  &FreeSansBold18pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSansBold24pt7b
+    { CF_FONT_SANS,  48, true,  &FreeSansBold24pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSansBold36pt7b
+    { CF_FONT_SANS,  60, true,  &FreeSansBold36pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSansBold48pt7b
+    { CF_FONT_SANS,  72, true,  &FreeSansBold48pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerif9pt7b
+    { CF_FONT_SERIF, 12, false, &FreeSerif9pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerif12pt7b
+    { CF_FONT_SERIF, 16, false, &FreeSerif12pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerif18pt7b
+    { CF_FONT_SERIF, 24, false, &FreeSerif18pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerif24pt7b
+    { CF_FONT_SERIF, 48, false, &FreeSerif24pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerif36pt7b
+    { CF_FONT_SERIF, 60, false, &FreeSerif36pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerif48pt7b
+    { CF_FONT_SERIF, 72, false, &FreeSerif48pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerifBold9pt7b
+    { CF_FONT_SERIF, 12, true,  &FreeSerifBold9pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerifBold12pt7b
+    { CF_FONT_SERIF, 16, true,  &FreeSerifBold12pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerifBold18pt7b
+    { CF_FONT_SERIF, 24, true,  &FreeSerifBold18pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerifBold24pt7b
+    { CF_FONT_SERIF, 48, true,  &FreeSerifBold24pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerifBold36pt7b
+    { CF_FONT_SERIF, 60, true,  &FreeSerifBold36pt7b },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerifBold48pt7b
+    { CF_FONT_SERIF, 72, true,  &FreeSerifBold48pt7b },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen13x1
+    { CF_FONT_MONO,  12, false, &Tamzen13x1 },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen16x1
+    { CF_FONT_MONO,  16, false, &Tamzen16x1 },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen26x2
+    { CF_FONT_MONO,  24, false, &Tamzen26x2 },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen32x2
+    { CF_FONT_MONO,  48, false, &Tamzen32x2 },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen60x3
+    { CF_FONT_MONO,  60, false, &Tamzen60x3 },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen80x4
+    { CF_FONT_MONO,  72, false, &Tamzen80x4 },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen13x1Bold
+    { CF_FONT_MONO,  12, true,  &Tamzen13x1Bold },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen16x1Bold
+    { CF_FONT_MONO,  16, true,  &Tamzen16x1Bold },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen26x2Bold
+    { CF_FONT_MONO,  24, true,  &Tamzen26x2Bold },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen32x2Bold
+    { CF_FONT_MONO,  48, true,  &Tamzen32x2Bold },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen60x3Bold
+    { CF_FONT_MONO,  60, true,  &Tamzen60x3Bold },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen80x4Bold
+    { CF_FONT_MONO,  72, true,  &Tamzen80x4Bold },
+#endif
+};
+
+// False if `text` has a printable ASCII character `font` cannot draw: one
+// outside its range, or dropped from a glyph subset (zero advance)
+inline bool fontCovers(const GFXfont* font, const char* text) {
+    for (const char* p = text; *p; p++) {
+        uint8_t c = (uint8_t)*p;
+        if (c < 0x20 || c > 0x7E) continue;
+        if (c < font->first || c > font->last || font->glyph[c - font->first].xAdvance == 0) return false;
+    }
+    return true;
+}
+
+// Exact match when linked. Otherwise the nearest linked size of the same
+// family and weight (the smaller on a tie, so text still fits its box),
+// then the other weight, then another family. Sizes the editor does not
+// offer map to 12, as before. Given `text`, a glyph subset that cannot
+// draw it is passed over, so a value synced after flashing still shows.
+inline const GFXfont* getFont(uint8_t family, int size, bool bold, const char* text = nullptr) {
+    switch (size) {
+        case 12: case 16: case 24: case 48: case 60: case 72: break;
+        default: size = 12;
+    }
+    const GFXfont* best = &FreeSans9pt7b;
+    int bestCost = 0x7FFF;
+    for (const CfFontEntry& e : cfFonts) {
+        int d = e.size - size;
+        int cost = (d < 0 ? -d * 2 : d * 2 + 1)
+                 + (e.bold != bold ? 1000 : 0)
+                 + (e.family != family ? 2000 : 0);
+        if (cost < bestCost && (!text || fontCovers(e.font, text))) { bestCost = cost; best = e.font; }
+    }
+    return best;
+}
+
 inline const GFXfont* getFont(const char* family, int size, bool bold) {
-    bool mono  = (family[0] == 'm'); // "mono"
-    bool serif = (family[0] == 's' && family[1] == 'e'); // "serif" vs "sans"
-
-    if (mono) {
-        if (bold) {
-            switch (size) {
-                case 72: return &Tamzen80x4Bold;
-                case 60: return &Tamzen60x3Bold;
-                case 48: return &Tamzen32x2Bold;
-                case 24: return &Tamzen26x2Bold;
-                case 16: return &Tamzen16x1Bold;
-                case 12: return &Tamzen13x1Bold;
-                default: return &Tamzen13x1Bold;
-            }
-        }
-        switch (size) {
-            case 72: return &Tamzen80x4;
-            case 60: return &Tamzen60x3;
-            case 48: return &Tamzen32x2;
-            case 24: return &Tamzen26x2;
-            case 16: return &Tamzen16x1;
-            case 12: return &Tamzen13x1;
-            default: return &Tamzen13x1;
-        }
+    return getFont(fontFamilyId(family), size, bold);
+}
+
+// ---- Text metrics ----
+
+// GFXMetrics tables emitted by the font generators (Tamzen, 36/48pt)
+inline const GFXMetrics* fontMetricsTable(const GFXfont* font) {
+    static const struct { const GFXfont* font; const GFXMetrics* metrics; } tables[] = {
+#ifdef CRISPFACE_FONT_Tamzen13x1
+        { &Tamzen13x1,          &Tamzen13x1Metrics },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen13x1Bold
+        { &Tamzen13x1Bold,      &Tamzen13x1BoldMetrics },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen16x1
+        { &Tamzen16x1,          &Tamzen16x1Metrics },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen16x1Bold
+        { &Tamzen16x1Bold,      &Tamzen16x1BoldMetrics },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen26x2
+        { &Tamzen26x2,          &Tamzen26x2Metrics },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen26x2Bold
+        { &Tamzen26x2Bold,      &Tamzen26x2BoldMetrics },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen32x2
+        { &Tamzen32x2,          &Tamzen32x2Metrics },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen32x2Bold
+        { &Tamzen32x2Bold,      &Tamzen32x2BoldMetrics },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen60x3
+        { &Tamzen60x3,          &Tamzen60x3Metrics },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen60x3Bold
+        { &Tamzen60x3Bold,      &Tamzen60x3BoldMetrics },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen80x4
+        { &Tamzen80x4,          &Tamzen80x4Metrics },
+#endif
+#ifdef CRISPFACE_FONT_Tamzen80x4Bold
+        { &Tamzen80x4Bold,      &Tamzen80x4BoldMetrics },
+#endif
+#ifdef CRISPFACE_FONT_FreeSans36pt7b
+        { &FreeSans36pt7b,      &FreeSans36pt7bMetrics },
+#endif
+#ifdef CRISPFACE_FONT_FreeSansBold36pt7b
+        { &FreeSansBold36pt7b,  &FreeSansBold36pt7bMetrics },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerif36pt7b
+        { &FreeSerif36pt7b,     &FreeSerif36pt7bMetrics },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerifBold36pt7b
+        { &FreeSerifBold36pt7b, &FreeSerifBold36pt7bMetrics },
+#endif
+#ifdef CRISPFACE_FONT_FreeSans48pt7b
+        { &FreeSans48pt7b,      &FreeSans48pt7bMetrics },
+#endif
+#ifdef CRISPFACE_FONT_FreeSansBold48pt7b
+        { &FreeSansBold48pt7b,  &FreeSansBold48pt7bMetrics },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerif48pt7b
+        { &FreeSerif48pt7b,     &FreeSerif48pt7bMetrics },
+#endif
+#ifdef CRISPFACE_FONT_FreeSerifBold48pt7b
+        { &FreeSerifBold48pt7b, &FreeSerifBold48pt7bMetrics },
+#endif
+    };
+    for (const auto& t : tables) {
+        if (t.font == font) return t.metrics;
     }
+    return nullptr;
+}
 
-    if (serif) {
-        if (bold) {
-            switch (size) {
-                case 72: return &FreeSerifBold48pt7b;
-                case 60: return &FreeSerifBold36pt7b;
-                case 48: return &FreeSerifBold24pt7b;
-                case 24: return &FreeSerifBold18pt7b;
-                case 16: return &FreeSerifBold12pt7b;
-                case 12: return &FreeSerifBold9pt7b;
-                default: return &FreeSerifBold9pt7b;
-            }
-        }
-        switch (size) {
-            case 72: return &FreeSerif48pt7b;
-            case 60: return &FreeSerif36pt7b;
-            case 48: return &FreeSerif24pt7b;
-            case 24: return &FreeSerif18pt7b;
-            case 16: return &FreeSerif12pt7b;
-            case 12: return &FreeSerif9pt7b;
-            default: return &FreeSerif9pt7b;
-        }
+// Line metrics for any font. Adafruit's bundled 9-24pt fonts have no
+// generated table; their 'A'/'y' extents come straight from two glyph
+// records, and advance is left null (measureText() reads the glyphs).
+inline GFXMetrics fontMetrics(const GFXfont* font) {
+    if (const GFXMetrics* m = fontMetricsTable(font)) return *m;
+    GFXMetrics m = { 0, 0, font->yAdvance, 1, font->first, font->last, nullptr };
+    int miny = 0, maxy = -1;
+    for (uint8_t c : { (uint8_t)'A', (uint8_t)'y' }) {
+        if (c < font->first || c > font->last) continue;
+        const GFXglyph& g = font->glyph[c - font->first];
+        if (g.height == 0) continue;
+        if (g.yOffset < miny) miny = g.yOffset;
+        if (g.yOffset + g.height - 1 > maxy) maxy = g.yOffset + g.height - 1;
     }
+    m.ascent  = (uint8_t)(-miny);
+    m.descent = (uint8_t)(maxy + 1);
+    return m;
+}
 
-    // Sans-serif (default)
-    if (bold) {
-        switch (size) {
-            case 72: return &FreeSansBold48pt7b;
-            case 60: return &FreeSansBold36pt7b;
-            case 48: return &FreeSansBold24pt7b;
-            case 24: return &FreeSansBold18pt7b;
-            case 16: return &FreeSansBold12pt7b;
-            case 12: return &FreeSansBold9pt7b;
-            default: return &FreeSansBold9pt7b;
-        }
+// Width of one line of text as the sum of glyph advances (what the
+// editor's canvas measureText() reports). `len` < 0 measures to the NUL.
+inline int measureText(const GFXfont* font, const char* str, int len = -1) {
+    const GFXMetrics* m = fontMetricsTable(font);
+    uint16_t first = font->first, last = font->last;
+    int w = 0;
+    for (int i = 0; len < 0 ? str[i] != '\0' : i < len; i++) {
+        uint8_t c = (uint8_t)str[i];
+        if (c < first || c > last) continue;
+        w += m ? m->advance[c - first] : font->glyph[c - first].xAdvance;
     }
+    return w;
+}
 
-    switch (size) {
-        case 72: return &FreeSans48pt7b;
-        case 60: return &FreeSans36pt7b;
-        case 48: return &FreeSans24pt7b;
-        case 24: return &FreeSans18pt7b;
-        case 16: return &FreeSans12pt7b;
-        case 12: return &FreeSans9pt7b;
-        default: return &FreeSans9pt7b;
+
+// ---- Stale text ----
+
+// Shear of the stale-text oblique: rows move right by up to a fifth of the
+// line height (tools/gfxoblique.py bakes the same shear into its variants)
+inline int obliqueSkew(const GFXMetrics& m) {
+    int skew = (m.ascent + m.descent + 2) / 5;
+    return skew < 1 ? 1 : skew;
+}
+
+// The linked oblique variant of a font, or nullptr (draw it skewed instead)
+inline const GFXfont* obliqueFont(const GFXfont* font) {
+    static const struct { const GFXfont* font; const GFXfont* oblique; } variants[] = {
+#ifdef CRISPFACE_OBLIQUE_FreeSans9pt7b
+        { &FreeSans9pt7b,       &FreeSans9pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSans12pt7b
+        { &FreeSans12pt7b,      &FreeSans12pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSans18pt7b
+        { &FreeSans18pt7b,      &FreeSans18pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSans24pt7b
+        { &FreeSans24pt7b,      &FreeSans24pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSans36pt7b
+        { &FreeSans36pt7b,      &FreeSans36pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSans48pt7b
+        { &FreeSans48pt7b,      &FreeSans48pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSansBold9pt7b
+        { &FreeSansBold9pt7b,   &FreeSansBold9pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSansBold12pt7b
+        { &FreeSansBold12pt7b,  &FreeSansBold12pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSansBold18pt7b
+        { &FreeSansBold18pt7b,  &FreeSansBold18pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSansBold24pt7b
+        { &FreeSansBold24pt7b,  &FreeSansBold24pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSansBold36pt7b
+        { &FreeSansBold36pt7b,  &FreeSansBold36pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSansBold48pt7b
+        { &FreeSansBold48pt7b,  &FreeSansBold48pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerif9pt7b
+        { &FreeSerif9pt7b,      &FreeSerif9pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerif12pt7b
+        { &FreeSerif12pt7b,     &FreeSerif12pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerif18pt7b
+        { &FreeSerif18pt7b,     &FreeSerif18pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerif24pt7b
+        { &FreeSerif24pt7b,     &FreeSerif24pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerif36pt7b
+        { &FreeSerif36pt7b,     &FreeSerif36pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerif48pt7b
+        { &FreeSerif48pt7b,     &FreeSerif48pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerifBold9pt7b
+        { &FreeSerifBold9pt7b,  &FreeSerifBold9pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerifBold12pt7b
+        { &FreeSerifBold12pt7b, &FreeSerifBold12pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerifBold18pt7b
+        { &FreeSerifBold18pt7b, &FreeSerifBold18pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerifBold24pt7b
+        { &FreeSerifBold24pt7b, &FreeSerifBold24pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerifBold36pt7b
+        { &FreeSerifBold36pt7b, &FreeSerifBold36pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_FreeSerifBold48pt7b
+        { &FreeSerifBold48pt7b, &FreeSerifBold48pt7bOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen13x1
+        { &Tamzen13x1,          &Tamzen13x1Oblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen16x1
+        { &Tamzen16x1,          &Tamzen16x1Oblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen26x2
+        { &Tamzen26x2,          &Tamzen26x2Oblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen32x2
+        { &Tamzen32x2,          &Tamzen32x2Oblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen60x3
+        { &Tamzen60x3,          &Tamzen60x3Oblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen80x4
+        { &Tamzen80x4,          &Tamzen80x4Oblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen13x1Bold
+        { &Tamzen13x1Bold,      &Tamzen13x1BoldOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen16x1Bold
+        { &Tamzen16x1Bold,      &Tamzen16x1BoldOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen26x2Bold
+        { &Tamzen26x2Bold,      &Tamzen26x2BoldOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen32x2Bold
+        { &Tamzen32x2Bold,      &Tamzen32x2BoldOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen60x3Bold
+        { &Tamzen60x3Bold,      &Tamzen60x3BoldOblique },
+#endif
+#ifdef CRISPFACE_OBLIQUE_Tamzen80x4Bold
+        { &Tamzen80x4Bold,      &Tamzen80x4BoldOblique },
+#endif
+        { nullptr, nullptr },
+    };
+    for (const auto& v : variants) {
+        if (v.font == font) return v.oblique;
     }
+    return nullptr;
 }
 
 #endif
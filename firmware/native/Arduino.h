@@ -0,0 +1,168 @@
+// Minimal Arduino core shim for the native (host) build.
+#ifndef CF_MOCK_ARDUINO_H
+#define CF_MOCK_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <sys/time.h>
+#include <string>
+
+#define PROGMEM
+#define pgm_read_byte(addr)    (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)    (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr)   (*(const uint32_t *)(addr))
+#define pgm_read_pointer(addr) ((void *)*(void * const *)(addr))
+
+#define LOW          0x0
+#define HIGH         0x1
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+#define RTC_DATA_ATTR
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void pinMode(uint8_t pin, uint8_t mode);
+int  digitalRead(uint8_t pin);
+
+// Like a core without small-string storage, a String holding any text
+// owns a heap buffer, so the native allocation count sees every one
+class String {
+public:
+    String() {}
+    String(const char* s) : s_(s ? s : "") { held(); }
+    String(const std::string& s) : s_(s) { held(); }
+    String(char c) : s_(1, c) { held(); }
+    String(int v)           : s_(std::to_string(v)) { held(); }
+    String(unsigned int v)  : s_(std::to_string(v)) { held(); }
+    String(long v)          : s_(std::to_string(v)) { held(); }
+    String(unsigned long v) : s_(std::to_string(v)) { held(); }
+    String(float v, unsigned char decimals = 2)  { fmt(v, decimals); }
+    String(double v, unsigned char decimals = 2) { fmt(v, decimals); }
+
+    unsigned int length() const { return (unsigned int)s_.size(); }
+    const char* c_str() const { return s_.c_str(); }
+    bool reserve(unsigned int n) { s_.reserve(n); return true; }
+
+    bool concat(const char* o) { if (o) s_ += o; held(); return true; }
+    String& operator+=(const String& o) { s_ += o.s_; return held(); }
+    String& operator+=(const char* o)   { if (o) s_ += o; return held(); }
+    String& operator+=(char c)          { s_ += c; return held(); }
+    friend String operator+(String a, const String& b) { a += b; return a; }
+    bool operator==(const String& o) const { return s_ == o.s_; }
+    bool operator==(const char* o) const { return o && s_ == o; }
+    bool operator!=(const char* o) const { return !(*this == o); }
+    char operator[](unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+
+    int indexOf(char c, unsigned int from = 0) const {
+        size_t p = s_.find(c, from);
+        return p == std::string::npos ? -1 : (int)p;
+    }
+    String substring(unsigned int from) const {
+        return from >= s_.size() ? String() : String(s_.substr(from));
+    }
+    String substring(unsigned int from, unsigned int to) const {
+        if (to > s_.size()) to = (unsigned int)s_.size();
+        return from >= to ? String() : String(s_.substr(from, to - from));
+    }
+    long toInt() const { return atol(s_.c_str()); }
+
+private:
+    String& held() {
+        if (!s_.empty() && s_.capacity() < 16) s_.reserve(16);
+        return *this;
+    }
+    void fmt(double v, unsigned char d) {
+        char b[32];
+        snprintf(b, sizeof(b), "%.*f", d, v);
+        s_ = b;
+        held();
+    }
+    std::string s_;
+};
+
+// ArduinoJson's String adapter also names this type
+class StringSumHelper : public String {
+public:
+    using String::String;
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buf, size_t n) {
+        size_t k = 0;
+        while (n--) k += write(*buf++);
+        return k;
+    }
+    size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+    size_t print(const char* s)   { return write(s); }
+    size_t print(const String& s) { return write(s.c_str()); }
+    size_t print(char c)          { return write((uint8_t)c); }
+    size_t print(int v)           { return print(String(v)); }
+    size_t print(unsigned int v)  { return print(String(v)); }
+    size_t print(long v)          { return print(String(v)); }
+    size_t print(unsigned long v) { return print(String(v)); }
+    size_t print(double v, int d = 2) { return print(String(v, (unsigned char)d)); }
+    size_t println()                  { return write("\n"); }
+    template <typename T> size_t println(const T& v) { size_t n = print(v); return n + println(); }
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual size_t readBytes(char* buf, size_t n) {
+        size_t k = 0;
+        while (k < n) {
+            int c = read();
+            if (c < 0) break;
+            buf[k++] = (char)c;
+        }
+        return k;
+    }
+    size_t readBytes(uint8_t* buf, size_t n) { return readBytes((char*)buf, n); }
+    size_t readBytesUntil(char term, char* buf, size_t n) {
+        size_t k = 0;
+        int c;
+        while (k < n && (c = read()) >= 0 && c != term) buf[k++] = (char)c;
+        return k;
+    }
+    String readStringUntil(char term) {
+        std::string s;
+        int c;
+        while ((c = read()) >= 0 && c != term) s += (char)c;
+        return String(s);
+    }
+    void setTimeout(unsigned long) {}
+};
+
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) override { return fputc(c, stderr) == EOF ? 0 : 1; }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+};
+extern HardwareSerial Serial;
+
+class IPAddress {
+public:
+    String toString() const { return String("127.0.0.1"); }
+};
+
+#endif
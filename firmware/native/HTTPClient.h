@@ -0,0 +1,63 @@
+// HTTPClient stand-in: responses come from cfMockHttp, set by the native runner.
+#ifndef CF_MOCK_HTTPCLIENT_H
+#define CF_MOCK_HTTPCLIENT_H
+
+#include "WiFiClientSecure.h"
+#include <map>
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTP_CODE_OK           200
+#define HTTP_CODE_NOT_MODIFIED 304
+
+typedef enum {
+    HTTPC_DISABLE_FOLLOW_REDIRECTS,
+    HTTPC_STRICT_FOLLOW_REDIRECTS,
+    HTTPC_FORCE_FOLLOW_REDIRECTS
+} followRedirects_t;
+
+struct CfMockHttp {
+    int code = HTTPC_ERROR_CONNECTION_REFUSED;
+    std::string body;
+    std::map<std::string, std::string> respHeaders;
+    std::map<std::string, std::string> reqHeaders; // last request
+    std::string url;                                // last request
+    int requests = 0;
+};
+extern CfMockHttp cfMockHttp;
+
+class HTTPClient {
+public:
+    bool begin(WiFiClient& client, const String& url) {
+        client_ = &client;
+        cfMockHttp.url = url.c_str();
+        cfMockHttp.reqHeaders.clear();
+        return true;
+    }
+    void end() {}
+    void addHeader(const String& k, const String& v) { cfMockHttp.reqHeaders[k.c_str()] = v.c_str(); }
+    void setUserAgent(const String&) {}
+    void setTimeout(uint16_t) {}
+    void setConnectTimeout(int32_t) {}
+    void setFollowRedirects(followRedirects_t) {}
+    void useHTTP10(bool = true) {}
+    void collectHeaders(const char* headerKeys[], const size_t headerKeysCount) { (void)headerKeys; (void)headerKeysCount; }
+    String header(const char* k) {
+        auto it = cfMockHttp.respHeaders.find(k);
+        return it == cfMockHttp.respHeaders.end() ? String() : String(it->second);
+    }
+    bool hasHeader(const char* k) { return cfMockHttp.respHeaders.count(k) > 0; }
+    int GET() {
+        cfMockHttp.requests++;
+        if (client_) client_->load(cfMockHttp.code > 0 ? cfMockHttp.body : std::string());
+        return cfMockHttp.code;
+    }
+    int getSize() { return cfMockHttp.code > 0 ? (int)cfMockHttp.body.size() : -1; }
+    String getString() { return String(cfMockHttp.body); }
+    WiFiClient& getStream() { return *client_; }
+    WiFiClient* getStreamPtr() { return client_; }
+    bool connected() { return client_ && client_->connected(); }
+private:
+    WiFiClient* client_ = nullptr;
+};
+
+#endif
@@ -0,0 +1,59 @@
+// SPIFFS stand-in backed by a host directory (flat namespace, like SPIFFS).
+#ifndef CF_MOCK_SPIFFS_H
+#define CF_MOCK_SPIFFS_H
+
+#include "Arduino.h"
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+class File : public Stream {
+public:
+    File(FILE* f = nullptr, unsigned long* wr = nullptr) : f_(f), wr_(wr) {}
+    explicit operator bool() const { return f_ != nullptr; }
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buf, size_t n) override {
+        size_t k = f_ ? fwrite(buf, 1, n, f_) : 0;
+        if (wr_) *wr_ += k;
+        return k;
+    }
+    using Print::write;
+    int available() override;
+    int read() override { return f_ ? fgetc(f_) : -1; }
+    int peek() override;
+    size_t read(uint8_t* buf, size_t n) { return f_ ? fread(buf, 1, n, f_) : 0; }
+    size_t readBytes(char* buf, size_t n) override { return read((uint8_t*)buf, n); }
+    size_t size() const;
+    bool seek(uint32_t pos) { return f_ && fseek(f_, pos, SEEK_SET) == 0; }
+    size_t position() const { return f_ ? (size_t)ftell(f_) : 0; }
+    void flush() { if (f_) fflush(f_); }
+    void close() { if (f_) fclose(f_); f_ = nullptr; }
+private:
+    FILE* f_;
+    unsigned long* wr_;
+};
+
+class SPIFFSFS {
+public:
+    bool begin(bool formatOnFail = false, const char* basePath = "/spiffs", uint8_t maxOpenFiles = 10);
+    void end() {}
+    File open(const char* path, const char* mode = FILE_READ);
+    bool exists(const char* path);
+    bool remove(const char* path);
+    bool rename(const char* from, const char* to);
+    size_t totalBytes() { return 1536 * 1024; }
+    size_t usedBytes();
+
+    // Host directory holding the files; set by the native runner
+    const char* root = "spiffs";
+    // Counters reset by the native runner
+    unsigned long opens = 0;
+    unsigned long mounts = 0;
+    unsigned long bytesWritten = 0;
+private:
+    const char* hostPath(const char* path, char* buf) const;
+};
+extern SPIFFSFS SPIFFS;
+
+#endif
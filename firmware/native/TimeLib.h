@@ -0,0 +1,23 @@
+// tmElements_t / makeTime() as provided to Watchy by the Time library.
+#ifndef CF_MOCK_TIMELIB_H
+#define CF_MOCK_TIMELIB_H
+
+#include <stdint.h>
+#include <time.h>
+
+typedef struct {
+    uint8_t Second;
+    uint8_t Minute;
+    uint8_t Hour;
+    uint8_t Wday;  // day of week, Sunday is day 1
+    uint8_t Day;
+    uint8_t Month;
+    uint8_t Year;  // offset from 1970
+} tmElements_t;
+
+typedef uint32_t time_t32;
+
+time_t makeTime(const tmElements_t& tm);
+void breakTime(time_t t, tmElements_t& tm);
+
+#endif
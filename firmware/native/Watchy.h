@@ -0,0 +1,146 @@
+// Host-side stand-in for sqfmi/Watchy: a 200x200 1bpp panel model with the
+// GxEPD2_BW calls CrispFace uses, a settable RTC, and inert hardware hooks.
+#ifndef CF_MOCK_WATCHY_H
+#define CF_MOCK_WATCHY_H
+
+#include "Arduino.h"
+#include "Adafruit_GFX.h"
+#include "TimeLib.h"
+#include "Wire.h"
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+#define WATCHFACE_STATE -1
+#define MAIN_MENU_STATE  0
+
+#define MENU_BTN_PIN 7
+#define BACK_BTN_PIN 6
+#define UP_BTN_PIN   0
+#define DOWN_BTN_PIN 8
+#define USB_DET_PIN  21
+#define MENU_BTN_MASK (1ULL << MENU_BTN_PIN)
+#define BACK_BTN_MASK (1ULL << BACK_BTN_PIN)
+#define UP_BTN_MASK   (1ULL << UP_BTN_PIN)
+#define DOWN_BTN_MASK (1ULL << DOWN_BTN_PIN)
+#define WATCHY_V3_SDA 12
+#define WATCHY_V3_SCL 11
+
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED,
+    ESP_SLEEP_WAKEUP_ALL,
+    ESP_SLEEP_WAKEUP_EXT0,
+    ESP_SLEEP_WAKEUP_EXT1,
+    ESP_SLEEP_WAKEUP_TIMER,
+} esp_sleep_wakeup_cause_t;
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause();
+uint64_t esp_sleep_get_ext1_wakeup_status();
+
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char* server1);
+bool getLocalTime(struct tm* info, uint32_t ms = 5000);
+
+extern int guiState;
+
+// Panel controller model: `panel` is what the e-paper shows, the display's
+// own buffer is what Adafruit_GFX draws into.
+class MockEPD {
+public:
+    static const int16_t WIDTH = 200;
+    static const int16_t HEIGHT = 200;
+    static const bool hasFastPartialUpdate = true;
+    void initWatchy() {}
+    void asyncPowerOn() {}
+};
+
+class MockDisplay : public Adafruit_GFX {
+public:
+    MockEPD epd2;
+    uint8_t buffer[MockEPD::WIDTH / 8 * MockEPD::HEIGHT];
+    uint8_t panel[MockEPD::WIDTH / 8 * MockEPD::HEIGHT];
+    uint8_t panelNext[MockEPD::WIDTH / 8 * MockEPD::HEIGHT]; // controller RAM
+
+    // Counters reset by the native runner
+    unsigned long pixelWrites = 0;
+    unsigned long fullRefreshes = 0;
+    unsigned long partialRefreshes = 0;
+    unsigned long windowRefreshes = 0;
+    unsigned long bytesToPanel = 0;
+
+    MockDisplay() : Adafruit_GFX(MockEPD::WIDTH, MockEPD::HEIGHT) {
+        memset(buffer, 0xFF, sizeof(buffer));
+        memset(panel, 0xFF, sizeof(panel));
+        memset(panelNext, 0xFF, sizeof(panelNext));
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void fillScreen(uint16_t color) override;
+
+    void init(uint32_t = 0, bool = true, uint16_t = 10, bool = false) {}
+    void setFullWindow() {}
+    void setPartialWindow(int16_t, int16_t, int16_t, int16_t) {}
+    void display(bool partial_update_mode = false);
+    void displayWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+    void writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part,
+                        int16_t w_bitmap, int16_t h_bitmap,
+                        int16_t x, int16_t y, int16_t w, int16_t h,
+                        bool invert = false, bool mirror_y = false, bool pgm = false);
+    void drawImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part,
+                       int16_t w_bitmap, int16_t h_bitmap,
+                       int16_t x, int16_t y, int16_t w, int16_t h,
+                       bool invert = false, bool mirror_y = false, bool pgm = false);
+    void drawImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                   bool invert = false, bool mirror_y = false, bool pgm = false) {
+        drawImagePart(bitmap, 0, 0, w, h, x, y, w, h, invert, mirror_y, pgm);
+    }
+    void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                    bool invert = false, bool mirror_y = false, bool pgm = false) {
+        writeImagePart(bitmap, 0, 0, w, h, x, y, w, h, invert, mirror_y, pgm);
+    }
+    void refresh(bool partial_update_mode = false);
+    void refresh(int16_t x, int16_t y, int16_t w, int16_t h);
+    void powerOff() {}
+    void hibernate() {}
+};
+
+class WatchyRTC {
+public:
+    void init() {}
+    void config(String) {}
+    void read(tmElements_t& tm);
+    void set(tmElements_t tm);
+};
+
+typedef struct watchySettings {
+    String cityID;
+    String lat;
+    String lon;
+    String weatherAPIKey;
+    String weatherURL;
+    String weatherUnit;
+    String weatherLang;
+    int8_t weatherUpdateInterval;
+    String ntpServer;
+    int gmtOffset;
+    bool vibrateOClock;
+} watchySettings;
+
+class Watchy {
+public:
+    static WatchyRTC RTC;
+    static MockDisplay display;
+    tmElements_t currentTime;
+    watchySettings settings;
+
+    explicit Watchy(const watchySettings& s) : settings(s) {}
+    virtual ~Watchy() {}
+    void init(String datetime = "");
+    void deepSleep() {}
+    float getBatteryVoltage();
+    void vibMotor(uint8_t intervalMs = 100, uint8_t length = 20) { (void)intervalMs; (void)length; }
+    virtual void handleButtonPress() {}
+    void showWatchFace(bool partialRefresh);
+    virtual void drawWatchFace() {}
+};
+
+#endif
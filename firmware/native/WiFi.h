@@ -0,0 +1,27 @@
+// Radio stand-in: the native build never connects.
+#ifndef CF_MOCK_WIFI_H
+#define CF_MOCK_WIFI_H
+
+#include "Arduino.h"
+
+typedef enum { WL_IDLE_STATUS = 0, WL_CONNECTED = 3, WL_DISCONNECTED = 6 } wl_status_t;
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1 } wifi_mode_t;
+
+// Set by the native runner to pretend an access point is in range
+extern bool cfMockWifiUp;
+
+class WiFiClass {
+public:
+    bool mode(wifi_mode_t) { return true; }
+    wl_status_t begin(const char*, const char* = nullptr) { return status(); }
+    wl_status_t status() { return cfMockWifiUp ? WL_CONNECTED : WL_DISCONNECTED; }
+    bool disconnect(bool = false) { return true; }
+    int16_t scanNetworks() { return cfMockWifiUp ? 1 : 0; }
+    void scanDelete() {}
+    String SSID(uint8_t) { return String("YourSSID"); }
+    int32_t RSSI(uint8_t = 0) { return 0; }
+    IPAddress localIP() { return IPAddress(); }
+};
+extern WiFiClass WiFi;
+
+#endif
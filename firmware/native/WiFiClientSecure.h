@@ -0,0 +1,34 @@
+#ifndef CF_MOCK_WIFICLIENTSECURE_H
+#define CF_MOCK_WIFICLIENTSECURE_H
+
+#include "WiFi.h"
+
+// Reads back whatever response body the native runner queued
+class WiFiClient : public Stream {
+public:
+    size_t write(uint8_t) override { return 1; }
+    int available() override { return (int)(body_.size() - pos_); }
+    int read() override { return pos_ < body_.size() ? (unsigned char)body_[pos_++] : -1; }
+    int peek() override { return pos_ < body_.size() ? (unsigned char)body_[pos_] : -1; }
+    size_t readBytes(char* buf, size_t n) override {
+        size_t k = body_.size() - pos_;
+        if (k > n) k = n;
+        memcpy(buf, body_.data() + pos_, k);
+        pos_ += k;
+        return k;
+    }
+    using Stream::readBytes;
+    bool connected() { return pos_ < body_.size(); }
+    void stop() {}
+    void load(const std::string& b) { body_ = b; pos_ = 0; }
+private:
+    std::string body_;
+    size_t pos_ = 0;
+};
+
+class WiFiClientSecure : public WiFiClient {
+public:
+    void setInsecure() {}
+};
+
+#endif
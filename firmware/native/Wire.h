@@ -0,0 +1,10 @@
+#ifndef CF_MOCK_WIRE_H
+#define CF_MOCK_WIRE_H
+
+class TwoWire {
+public:
+    bool begin(int = -1, int = -1) { return true; }
+};
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,249 @@
+// Render microbenchmarks for the native environment (pio run -e native_bench).
+//
+//   bench [-f filter] [-m ms] [-o results.json]
+//
+// Sweeps the text, border and icon drawing paths over every linked font,
+// string lengths, alignments, border widths and icon sizes. Each case runs
+// for at least `ms` milliseconds (default 20) and reports ns per call,
+// cfFrame.drawPixel() calls per call, and the frame bytes one call changes
+// when drawn black on a white frame. A sync sweep feeds syncFromServer()
+// responses of 3 to 330 faces (about 2 KB to 200 KB), plain and deflated
+// as watch_faces.py sends them (faces past CF_MAX_FACES are skipped
+// unparsed), and records the most JSON arena any one document used.
+// Results are written as JSON (stdout by default) so two runs can be
+// compared with tools/benchcmp.py. `filter` keeps the cases whose name
+// contains it.
+#include "../src/main.cpp"
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+struct CfNative {
+    struct Result {
+        std::string name;
+        double ns;
+        uint32_t pixels;
+        int bytes;
+        uint32_t json; // peak JSON arena bytes
+    };
+
+    std::vector<Result> results;
+    const char* filter = nullptr;
+    double minMs = 20;
+
+    template <typename Fn>
+    void bench(const std::string& name, Fn fn) {
+        if (filter && name.find(filter) == std::string::npos) return;
+
+        // Footprint and per-pixel calls of one call on a clean frame
+        static uint8_t before[CF_LAYER_BYTES];
+        cfFrame.fillScreen(GxEPD_WHITE);
+        memcpy(before, cfFrame.buffer(), CF_LAYER_BYTES);
+        cfFrame.pixelCalls = 0;
+        cfJsonPeak = 0;
+        fn();
+        uint32_t pixels = cfFrame.pixelCalls;
+        uint32_t json = cfJsonPeak;
+        int bytes = 0;
+        for (int i = 0; i < CF_LAYER_BYTES; i++) bytes += before[i] != cfFrame.buffer()[i];
+
+        // Time batches until the budget is spent
+        long calls = 0;
+        double elapsed = 0;
+        for (long batch = 1; elapsed < minMs * 1e6; batch *= 2) {
+            auto t0 = std::chrono::steady_clock::now();
+            for (long i = 0; i < batch; i++) fn();
+            auto t1 = std::chrono::steady_clock::now();
+            elapsed += std::chrono::duration<double, std::nano>(t1 - t0).count();
+            calls += batch;
+        }
+        results.push_back({ name, elapsed / calls, pixels, bytes, json });
+        fprintf(stderr, "%-48s %10.0f ns %8u px %5d B", name.c_str(), elapsed / calls, pixels, bytes);
+        if (json) fprintf(stderr, " %6u B json", json);
+        fprintf(stderr, "\n");
+    }
+
+    static std::string fontName(const CfFontEntry& e) {
+        static const char* families[] = { "sans", "serif", "mono" };
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%s%d%s", families[e.family], e.size, e.bold ? "b" : "");
+        return buf;
+    }
+
+    static std::string sample(int len) {
+        static const char words[] = "The quick brown fox jumps over the lazy dog 0123456789 ";
+        std::string s;
+        while ((int)s.size() < len) s += words[s.size() % (sizeof(words) - 1)];
+        return s;
+    }
+
+    void text() {
+        static const char* aligns[] = { "left", "center", "right" };
+        for (const CfFontEntry& e : cfFonts) {
+            for (int len : { 5, 20, 80 }) {
+                std::string str = sample(len);
+                for (uint8_t al = CF_ALIGN_LEFT; al <= CF_ALIGN_RIGHT; al++) {
+                    char name[64];
+                    snprintf(name, sizeof(name), "drawAligned/%s/len%d/%s", fontName(e).c_str(), len, aligns[al]);
+                    bench(name, [&] { face.drawAligned(str.c_str(), 0, 0, 200, 200, al, e.font, GxEPD_BLACK); });
+                }
+                // Stale text: oblique variant if linked, else sheared blit
+                char name[64];
+                snprintf(name, sizeof(name), "drawAligned/oblique/%s/len%d", fontName(e).c_str(), len);
+                bench(name, [&] { face.drawAligned(str.c_str(), 0, 0, 200, 200, CF_ALIGN_LEFT, e.font, GxEPD_BLACK, nullptr, true); });
+            }
+        }
+    }
+
+    void wrap() {
+        static char out[1024];
+        for (const CfFontEntry& e : cfFonts) {
+            if (e.size > 24) continue; // notification sizes
+            for (int len : { 40, 160, 480 }) {
+                std::string str = sample(len);
+                for (int w : { 90, 180 }) {
+                    char name[64];
+                    snprintf(name, sizeof(name), "wordWrap/%s/len%d/w%d", fontName(e).c_str(), len, w);
+                    bench(name, [&] { face.wordWrap(str.c_str(), out, sizeof(out), w, e.font); });
+                }
+            }
+        }
+    }
+
+    void borders() {
+        for (int bw : { 1, 2, 4, 8 }) {
+            for (int br : { 0, 6, 20 }) {
+                char name[64];
+                snprintf(name, sizeof(name), "drawBorder/bw%d/br%d", bw, br);
+                bench(name, [&] { face.drawBorder(10, 10, 180, 120, bw, br, GxEPD_BLACK); });
+            }
+        }
+    }
+
+    void battery() {
+        for (int w : { 24, 48, 96 }) {
+            for (bool charging : { false, true }) {
+                char name[64];
+                snprintf(name, sizeof(name), "drawBatteryIcon/%dx%d%s", w, w / 2, charging ? "/charging" : "");
+                bench(name, [&] { face.drawBatteryIcon(20, 20, w, w / 2, GxEPD_BLACK, 64, charging); });
+            }
+        }
+    }
+
+    void weather() {
+        // Met Office codes, one per icon bucket: sun, part cloud, fog, cloud,
+        // light rain, heavy rain, snow, thunder
+        static const int codes[] = { 1, 3, 6, 7, 12, 15, 24, 30 };
+        for (int s : { 16, 32, 64, 96, 120 }) { // 120 is off the atlas (drawn)
+            for (int code : codes) {
+                char name[64];
+                snprintf(name, sizeof(name), "drawWeatherIcon/%d/code%d", s, code);
+                bench(name, [&] { face.drawWeatherIcon(code, 10, 10, s, s, GxEPD_BLACK); });
+            }
+        }
+    }
+
+    // One face as the sync response carries it: a local time, a bordered
+    // server value and a wrapped static text
+    static std::string syncFace(int i) {
+        char buf[1024];
+        snprintf(buf, sizeof(buf),
+            "{\"id\":\"f%d\",\"name\":\"Face %d\",\"bg\":\"white\",\"stale\":60,\"complications\":["
+            "{\"id\":\"time\",\"type\":\"time\",\"x\":0,\"y\":0,\"w\":200,\"h\":70,\"stale\":-1,\"value\":\"\","
+            "\"font\":\"sans\",\"size\":48,\"bold\":false,\"align\":\"center\",\"color\":\"black\",\"local\":true},"
+            "{\"id\":\"w\",\"type\":\"weather\",\"x\":0,\"y\":80,\"w\":200,\"h\":30,\"stale\":600,\"value\":\"Rain %dC\","
+            "\"font\":\"sans\",\"size\":16,\"bold\":false,\"align\":\"left\",\"color\":\"black\",\"bw\":1,\"bp\":2},"
+            "{\"id\":\"t\",\"type\":\"text\",\"x\":0,\"y\":120,\"w\":200,\"h\":60,\"stale\":-1,"
+            "\"value\":\"Static text on face %d, long enough to wrap over a few lines\","
+            "\"font\":\"serif\",\"size\":12,\"bold\":true,\"align\":\"center\",\"color\":\"black\"}]}",
+            i, i, i % 30, i);
+        return buf;
+    }
+
+    // A body as watch_faces.py deflates it: zlib, 4 KB window
+    static std::string deflated(const std::string& in) {
+        z_stream z = {};
+        deflateInit2(&z, 9, Z_DEFLATED, 12, 8, Z_DEFAULT_STRATEGY);
+        std::string out(deflateBound(&z, in.size()), '\0');
+        z.next_in = (Bytef*)in.data();
+        z.avail_in = (uInt)in.size();
+        z.next_out = (Bytef*)&out[0];
+        z.avail_out = (uInt)out.size();
+        deflate(&z, Z_FINISH);
+        out.resize(z.total_out);
+        deflateEnd(&z);
+        return out;
+    }
+
+    void sync() {
+        char dir[] = "/tmp/cfbenchXXXXXX";
+        if (!mkdtemp(dir)) { perror("mkdtemp"); return; }
+        SPIFFS.root = dir;
+        cfMockWifiUp = true;
+        cfMockHttp.code = HTTP_CODE_OK;
+        for (int n : { 3, 30, 330 }) {
+            std::string body = "{\"success\":true,\"faces\":[";
+            for (int i = 0; i < n; i++) body += (i ? "," : "") + syncFace(i);
+            body += "],\"wifi\":[],\"layout\":\"\",\"fetched_at\":0}";
+            char name[64];
+            snprintf(name, sizeof(name), "syncFromServer/%dfaces/%dKB", n, (int)(body.size() + 512) / 1024);
+            // The first call writes every face; the timed ones find them
+            // all in the manifest and only parse and compile
+            cfMockHttp.body = body;
+            cfMockHttp.respHeaders.erase("Content-Encoding");
+            bench(name, [&] { face.syncFromServer(); });
+
+            cfMockHttp.body = deflated(body);
+            cfMockHttp.respHeaders["Content-Encoding"] = "deflate";
+            snprintf(name, sizeof(name), "syncFromServer/%dfaces/deflate/%dB", n, (int)cfMockHttp.body.size());
+            bench(name, [&] { face.syncFromServer(); });
+        }
+        cfMockHttp.respHeaders.erase("Content-Encoding");
+        char rm[64];
+        snprintf(rm, sizeof(rm), "rm -rf %s", dir);
+        if (system(rm) != 0) fprintf(stderr, "cannot remove %s\n", dir);
+    }
+
+    void writeJson(FILE* f) {
+        fprintf(f, "{\n  \"fonts\": %d,\n  \"results\": [\n", (int)(sizeof(cfFonts) / sizeof(cfFonts[0])));
+        for (size_t i = 0; i < results.size(); i++) {
+            const Result& r = results[i];
+            fprintf(f, "    {\"name\": \"%s\", \"ns\": %.1f, \"pixels\": %u, \"bytes\": %d, \"json\": %u}%s\n",
+                    r.name.c_str(), r.ns, r.pixels, r.bytes, r.json, i + 1 < results.size() ? "," : "");
+        }
+        fprintf(f, "  ]\n}\n");
+    }
+};
+
+int main(int argc, char** argv) {
+    CfNative b;
+    const char* out = nullptr;
+    for (int i = 1; i < argc; i += 2) {
+        if (i + 1 < argc && strcmp(argv[i], "-f") == 0) b.filter = argv[i + 1];
+        else if (i + 1 < argc && strcmp(argv[i], "-m") == 0) b.minMs = atof(argv[i + 1]);
+        else if (i + 1 < argc && strcmp(argv[i], "-o") == 0) out = argv[i + 1];
+        else {
+            fprintf(stderr, "usage: bench [-f filter] [-m ms] [-o results.json]\n");
+            return 2;
+        }
+    }
+
+    Watchy::RTC.read(face.currentTime);
+    b.text();
+    b.wrap();
+    b.borders();
+    b.battery();
+    b.weather();
+    b.sync();
+
+    FILE* f = out ? fopen(out, "w") : stdout;
+    if (!f) { fprintf(stderr, "cannot write %s\n", out); return 1; }
+    b.writeJson(f);
+    if (out) fclose(f);
+    return 0;
+}
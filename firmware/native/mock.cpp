@@ -0,0 +1,279 @@
+// Implementations behind the host-side Arduino/Watchy stand-ins.
+#include "Arduino.h"
+#include "Watchy.h"
+#include "SPIFFS.h"
+#include "HTTPClient.h"
+#include <stdarg.h>
+#include <chrono>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <limits.h>
+#include <unistd.h>
+#include <new>
+
+HardwareSerial Serial;
+TwoWire Wire;
+WiFiClass WiFi;
+SPIFFSFS SPIFFS;
+CfMockHttp cfMockHttp;
+bool cfMockWifiUp = false;
+int guiState = WATCHFACE_STATE;
+
+static auto cfStart = std::chrono::steady_clock::now();
+unsigned long millis() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - cfStart).count();
+}
+unsigned long micros() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - cfStart).count();
+}
+// Every C++ heap allocation (String, ArduinoJson documents, std containers)
+// goes through these, so the runner can check a wake allocates nothing.
+// libc's own malloc() callers (stdio, setenv) are not counted.
+unsigned long cfAllocCount = 0;
+void* operator new(size_t n) {
+    cfAllocCount++;
+    if (void* p = malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](size_t n) { return operator new(n); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+void delay(unsigned long) {}
+void pinMode(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return HIGH; }
+
+size_t Print::printf(const char* fmt, ...) {
+    char buf[512];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0) return 0;
+    return write((const uint8_t*)buf, strlen(buf));
+}
+
+// ---- time ----
+
+time_t makeTime(const tmElements_t& t) {
+    struct tm tm = {};
+    tm.tm_year = t.Year + 70;
+    tm.tm_mon  = t.Month - 1;
+    tm.tm_mday = t.Day;
+    tm.tm_hour = t.Hour;
+    tm.tm_min  = t.Minute;
+    tm.tm_sec  = t.Second;
+    return timegm(&tm);
+}
+
+void breakTime(time_t t, tmElements_t& out) {
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    out.Year   = tm.tm_year - 70;
+    out.Month  = tm.tm_mon + 1;
+    out.Day    = tm.tm_mday;
+    out.Hour   = tm.tm_hour;
+    out.Minute = tm.tm_min;
+    out.Second = tm.tm_sec;
+    out.Wday   = tm.tm_wday + 1;
+}
+
+// The mock RTC is the host's settimeofday-free clock: a settable epoch.
+time_t cfMockEpoch = 1760000000;
+
+void WatchyRTC::read(tmElements_t& tm) { breakTime(cfMockEpoch, tm); }
+void WatchyRTC::set(tmElements_t tm) { cfMockEpoch = makeTime(tm); }
+
+esp_sleep_wakeup_cause_t cfMockWakeCause = ESP_SLEEP_WAKEUP_TIMER;
+uint64_t cfMockWakeBits = 0;
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() { return cfMockWakeCause; }
+uint64_t esp_sleep_get_ext1_wakeup_status() { return cfMockWakeBits; }
+
+void configTime(long, int, const char*) {}
+bool cfMockNtp = false;
+bool getLocalTime(struct tm* info, uint32_t) {
+    if (!cfMockNtp) return false;
+    gmtime_r(&cfMockEpoch, info);
+    return true;
+}
+
+// ---- display ----
+
+void MockDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    pixelWrites++;
+    if (x < 0 || y < 0 || x >= MockEPD::WIDTH || y >= MockEPD::HEIGHT) return;
+    uint16_t i = x / 8 + y * (MockEPD::WIDTH / 8);
+    if (color) buffer[i] |= (1 << (7 - x % 8));
+    else       buffer[i] &= ~(1 << (7 - x % 8));
+}
+
+void MockDisplay::fillScreen(uint16_t color) {
+    memset(buffer, color ? 0xFF : 0x00, sizeof(buffer));
+}
+
+void MockDisplay::display(bool partial) {
+    memcpy(panelNext, buffer, sizeof(panelNext));
+    memcpy(panel, buffer, sizeof(panel));
+    bytesToPanel += sizeof(panel);
+    if (partial) partialRefreshes++; else fullRefreshes++;
+}
+
+void MockDisplay::displayWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+    int16_t x1 = x & ~7, x2 = (x + w + 7) & ~7;
+    if (x1 < 0) x1 = 0;
+    if (x2 > MockEPD::WIDTH) x2 = MockEPD::WIDTH;
+    for (int16_t r = y; r < y + h && r < MockEPD::HEIGHT; r++) {
+        if (r < 0) continue;
+        int off = r * (MockEPD::WIDTH / 8);
+        memcpy(panel + off + x1 / 8, buffer + off + x1 / 8, (x2 - x1) / 8);
+        memcpy(panelNext + off + x1 / 8, buffer + off + x1 / 8, (x2 - x1) / 8);
+        bytesToPanel += (x2 - x1) / 8;
+    }
+    windowRefreshes++;
+}
+
+void MockDisplay::writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part,
+                                 int16_t w_bitmap, int16_t h_bitmap,
+                                 int16_t x, int16_t y, int16_t w, int16_t h,
+                                 bool invert, bool, bool) {
+    // Controller RAM write: bytes land in the panel's "next" image. The model
+    // keeps one image, so the write goes to panel memory via the buffer copy.
+    (void)h_bitmap;
+    int wb = (w_bitmap + 7) / 8;
+    for (int16_t r = 0; r < h; r++) {
+        for (int16_t c = 0; c < w; c++) {
+            int sx = x_part + c, sy = y_part + r;
+            uint8_t b = bitmap[sy * wb + sx / 8];
+            if (invert) b = ~b;
+            bool white = b & (0x80 >> (sx & 7));
+            int dx = x + c, dy = y + r;
+            if (dx < 0 || dy < 0 || dx >= MockEPD::WIDTH || dy >= MockEPD::HEIGHT) continue;
+            int i = dy * (MockEPD::WIDTH / 8) + dx / 8;
+            if (white) panelNext[i] |= (0x80 >> (dx & 7));
+            else       panelNext[i] &= ~(0x80 >> (dx & 7));
+        }
+        bytesToPanel += (w + 7) / 8;
+    }
+}
+
+void MockDisplay::drawImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part,
+                                int16_t w_bitmap, int16_t h_bitmap,
+                                int16_t x, int16_t y, int16_t w, int16_t h,
+                                bool invert, bool mirror_y, bool pgm) {
+    writeImagePart(bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+    refresh(x, y, w, h);
+}
+
+void MockDisplay::refresh(bool partial) {
+    memcpy(panel, panelNext, sizeof(panel));
+    if (partial) partialRefreshes++; else fullRefreshes++;
+}
+
+void MockDisplay::refresh(int16_t, int16_t, int16_t, int16_t) {
+    memcpy(panel, panelNext, sizeof(panel));
+    windowRefreshes++;
+}
+
+// ---- Watchy ----
+
+WatchyRTC Watchy::RTC;
+MockDisplay Watchy::display;
+
+float cfMockBattery = 4.0f;
+float Watchy::getBatteryVoltage() { return cfMockBattery; }
+
+void Watchy::showWatchFace(bool partialRefresh) {
+    display.setFullWindow();
+    drawWatchFace();
+    display.display(partialRefresh);
+}
+
+void Watchy::init(String) {
+    RTC.read(currentTime);
+    if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT1) {
+        handleButtonPress();
+    } else if (guiState == WATCHFACE_STATE) {
+        showWatchFace(true);
+    }
+    deepSleep();
+}
+
+// ---- SPIFFS ----
+
+// Into a caller buffer: the mock must not add heap traffic of its own
+const char* SPIFFSFS::hostPath(const char* path, char* buf) const {
+    snprintf(buf, 256, "%s%s%s", root, path[0] == '/' ? "" : "/", path);
+    return buf;
+}
+
+bool SPIFFSFS::begin(bool, const char*, uint8_t) {
+    mkdir(root, 0755);
+    mounts++;
+    return true;
+}
+
+File SPIFFSFS::open(const char* path, const char* mode) {
+    opens++;
+    char hp[256];
+    FILE* f = fopen(hostPath(path, hp), mode[0] == 'w' ? "wb" : (mode[0] == 'a' ? "ab" : "rb"));
+    return File(f, mode[0] != 'r' ? &bytesWritten : nullptr);
+}
+
+bool SPIFFSFS::exists(const char* path) {
+    struct stat st;
+    char hp[256];
+    return stat(hostPath(path, hp), &st) == 0;
+}
+
+bool SPIFFSFS::remove(const char* path) {
+    char hp[256];
+    return unlink(hostPath(path, hp)) == 0;
+}
+
+bool SPIFFSFS::rename(const char* from, const char* to) {
+    char a[256], b[256];
+    return ::rename(hostPath(from, a), hostPath(to, b)) == 0;
+}
+
+size_t SPIFFSFS::usedBytes() {
+    size_t total = 0;
+    DIR* d = opendir(root);
+    if (!d) return 0;
+    while (struct dirent* e = readdir(d)) {
+        struct stat st;
+        char p[PATH_MAX];
+        if (snprintf(p, sizeof(p), "%s/%s", root, e->d_name) >= (int)sizeof(p)) continue;
+        if (stat(p, &st) == 0 && S_ISREG(st.st_mode)) total += st.st_size;
+    }
+    closedir(d);
+    return total;
+}
+
+int File::available() {
+    if (!f_) return 0;
+    long cur = ftell(f_);
+    fseek(f_, 0, SEEK_END);
+    long end = ftell(f_);
+    fseek(f_, cur, SEEK_SET);
+    return (int)(end - cur);
+}
+
+int File::peek() {
+    if (!f_) return -1;
+    int c = fgetc(f_);
+    if (c != EOF) ungetc(c, f_);
+    return c;
+}
+
+size_t File::size() const {
+    if (!f_) return 0;
+    long cur = ftell(f_);
+    fseek(f_, 0, SEEK_END);
+    long end = ftell(f_);
+    fseek(f_, cur, SEEK_SET);
+    return (size_t)end;
+}
@@ -0,0 +1,219 @@
+// Headless face renderer for the native environment (pio run -e native).
+//
+//   render <face.json> [-f index] [-t epoch] [-a age] [-b volts] [-n runs] [-o out.pbm]
+//
+// Loads a face as the sync payload carries it (a single face object, or a
+// whole payload with -f picking one of its "faces"), compiles it with the
+// firmware's compileFace() and draws every complication into cfFrame at
+// RTC time `epoch`, `age` seconds after the last sync (stale text shows
+// once age passes a complication's stale time). Prints the wall time per
+// complication, averaged over `runs` draws, and writes the frame as a PBM.
+//
+// Then replays two minute-tick wakes of the face through CrispFace::init()
+// (SPIFFS in a scratch directory, no sync due) and counts the C++ heap
+// allocations each makes, then checks the panel after the second (window
+// only) wake against a full render of that minute. Exits with status 3 if
+// either wake allocates, 4 if the panel differs, or 5 if patching the
+// face's own values into its record (as a delta sync does) changes it.
+#include "../src/main.cpp"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+
+extern time_t cfMockEpoch;
+extern float cfMockBattery;
+extern unsigned long cfAllocCount;
+
+struct CfNative {
+    static const char* kindName(uint8_t kind) {
+        static const char* names[] = { "text", "icon", "time", "date", "version", "battery", "local" };
+        return kind < sizeof(names) / sizeof(names[0]) ? names[kind] : "?";
+    }
+
+    static bool writePbm(const char* path) {
+        FILE* f = fopen(path, "wb");
+        if (!f) return false;
+        fprintf(f, "P4\n200 200\n");
+        // cfFrame is 1 = white, PBM is 1 = black
+        const uint8_t* buf = cfFrame.buffer();
+        for (int i = 0; i < CF_LAYER_BYTES; i++) fputc(~buf[i] & 0xFF, f);
+        fclose(f);
+        return true;
+    }
+
+    static int run(JsonObject faceJson, int runs, int age, const char* out) {
+        CrispFace& cf = face;
+        int len = cf.compileFace(faceJson, cfFaceBuf, sizeof(cfFaceBuf));
+        const CfFaceHeader* hdr = (const CfFaceHeader*)cfFaceBuf;
+        const CfCompRec* recs = (const CfCompRec*)(cfFaceBuf + sizeof(CfFaceHeader));
+
+        Watchy::RTC.read(cf.currentTime);
+        int now = makeTime(cf.currentTime);
+        cfLastSync = now - age;
+
+        printf("face \"%s\": %d complications, %d-byte record, %04d-%02d-%02d %02d:%02d, synced %ds ago\n",
+               (const char*)(faceJson["name"] | ""), hdr->compCount, len,
+               cf.currentTime.Year + 1970, cf.currentTime.Month, cf.currentTime.Day,
+               cf.currentTime.Hour, cf.currentTime.Minute, age);
+        printf("  #  kind     box                   us/draw\n");
+
+        cfFrame.fillScreen(hdr->bg == CF_COLOR_BLACK ? GxEPD_BLACK : GxEPD_WHITE);
+        double total = 0;
+        for (int i = 0; i < hdr->compCount; i++) {
+            const CfCompRec& c = recs[i];
+            const char* val = (const char*)cfFaceBuf + c.value;
+            // Drawing is idempotent, so repeats leave the frame as one draw would
+            auto t0 = std::chrono::steady_clock::now();
+            for (int r = 0; r < runs; r++) cf.renderComplication(c, val, now);
+            auto t1 = std::chrono::steady_clock::now();
+            double us = std::chrono::duration<double, std::micro>(t1 - t0).count() / runs;
+            total += us;
+            char box[32];
+            snprintf(box, sizeof(box), "%d,%d %dx%d", c.x, c.y, c.w, c.h);
+            printf("%3d  %-8s %-20s %9.2f\n", i, kindName(c.kind), box, us);
+        }
+        printf("total %.2f us\n", total);
+
+        if (!writePbm(out)) {
+            fprintf(stderr, "cannot write %s\n", out);
+            return 1;
+        }
+        printf("wrote %s\n", out);
+        int status = patches(faceJson, len);
+        int woke = wake(len, now, age);
+        return status ? status : woke;
+    }
+
+    // A value-only delta must rebuild the record byte for byte: patching
+    // each server complication with the value it was compiled from has to
+    // give back the compiled record. A value past CF_MAX_COMPS, which the
+    // server sends for a face the record cut short, must leave it alone.
+    static int patches(JsonObject faceJson, int len) {
+        alignas(4) static uint8_t rec[CF_FACE_MAX_BYTES];
+        const CfFaceHeader* hdr = (const CfFaceHeader*)cfFaceBuf;
+        const CfCompRec* recs = (const CfCompRec*)(cfFaceBuf + sizeof(CfFaceHeader));
+        JsonArray comps = faceJson["complications"].as<JsonArray>();
+        int bad = 0;
+        for (int i = 0; i < hdr->compCount; i++) {
+            if (recs[i].flags & CF_COMP_LOCAL) continue;
+            memcpy(rec, cfFaceBuf, len);
+            int n = face.patchFaceValue(rec, sizeof(rec), i, comps[i]["value"] | "");
+            if (n != len || memcmp(rec, cfFaceBuf, len)) {
+                printf("patch %d: record differs from the compiled face\n", i);
+                bad++;
+            }
+        }
+        memcpy(rec, cfFaceBuf, len);
+        int want = hdr->compCount == CF_MAX_COMPS ? len : 0;
+        if (face.patchFaceValue(rec, sizeof(rec), CF_MAX_COMPS, "x") != want || memcmp(rec, cfFaceBuf, len)) {
+            printf("patch %d: not %s\n", CF_MAX_COMPS, want ? "ignored" : "refused");
+            bad++;
+        }
+        printf("value patches: %d bad\n", bad);
+        return bad ? 5 : 0;
+    }
+
+    // Minute ticks of face 0 as the watch runs them between syncs: the
+    // first loads the record from SPIFFS and draws over the static layer,
+    // the second hits the RTC cache and pushes only the changed window.
+    static int wake(int len, int now, int age) {
+        char dir[] = "/tmp/cfwakeXXXXXX";
+        if (!mkdtemp(dir)) { perror("mkdtemp"); return 1; }
+        SPIFFS.root = dir;
+        File f = SPIFFS.open("/face_0.bin", FILE_WRITE);
+        f.write(cfFaceBuf, len);
+        f.close();
+        face.saveLayer(0, cfFaceBuf);
+
+        cfFaceCount = 1;
+        cfFaceIndex = 0;
+        cfFaceGen++;
+        cfRtcFaceIdx = -1;
+        cfPanelFace = -1;
+        cfFirstBoot = false;
+        cfNeedsSync = false;
+        cfTimeSeeded = true;
+        cfSyncInterval = age + 600;
+        cfLastTimeSave = now;
+        face.cfFsMounted = false;
+
+        int status = 0;
+        for (int tick = 1; tick <= 2; tick++) {
+            cfMockEpoch = now + 60 * tick;
+            unsigned long before = cfAllocCount;
+            face.init();
+            unsigned long allocs = cfAllocCount - before;
+            printf("wake %d: %lu heap allocations\n", tick, allocs);
+            if (allocs) status = 3;
+        }
+
+        // The second wake pushed only a window; the panel must still match
+        // a full render of the same minute
+        static uint8_t shown[CF_LAYER_BYTES];
+        memcpy(shown, Watchy::display.panel, sizeof(shown));
+        cfPanelFace = -1;
+        face.renderFace(0);
+        int diff = 0;
+        for (int i = 0; i < CF_LAYER_BYTES; i++) diff += shown[i] != cfFrame.buffer()[i];
+        printf("window tick vs full render: %d bytes differ\n", diff);
+        if (diff && !status) status = 4;
+
+        SPIFFS.remove("/face_0.bin");
+        SPIFFS.remove("/face_0.img");
+        rmdir(dir);
+        return status;
+    }
+};
+
+static int usage() {
+    fprintf(stderr, "usage: render <face.json> [-f index] [-t epoch] [-a age] [-b volts] [-n runs] [-o out.pbm]\n");
+    return 2;
+}
+
+int main(int argc, char** argv) {
+    const char* path = nullptr;
+    const char* out = "face.pbm";
+    int index = 0, runs = 100, age = 0;
+    for (int i = 1; i < argc; i++) {
+        const char* a = argv[i];
+        if (a[0] != '-') { path = a; continue; }
+        if (i + 1 >= argc) return usage();
+        const char* v = argv[++i];
+        switch (a[1]) {
+            case 'f': index = atoi(v); break;
+            case 't': cfMockEpoch = (time_t)atoll(v); break;
+            case 'a': age = atoi(v); break;
+            case 'b': cfMockBattery = (float)atof(v); break;
+            case 'n': runs = atoi(v) > 0 ? atoi(v) : 1; break;
+            case 'o': out = v; break;
+            default: return usage();
+        }
+    }
+    if (!path) return usage();
+
+    FILE* f = fopen(path, "rb");
+    if (!f) { fprintf(stderr, "cannot read %s\n", path); return 1; }
+    std::string json;
+    char chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) json.append(chunk, n);
+    fclose(f);
+
+    DynamicJsonDocument doc(json.size() * 2 + 4096);
+    DeserializationError err = deserializeJson(doc, json.c_str(), json.size());
+    if (err) { fprintf(stderr, "%s: %s\n", path, err.c_str()); return 1; }
+
+    JsonObject faceJson = doc.as<JsonObject>();
+    if (faceJson.containsKey("faces")) {
+        JsonArray faces = faceJson["faces"].as<JsonArray>();
+        if (index < 0 || index >= (int)faces.size()) {
+            fprintf(stderr, "%s: no face %d (%d faces)\n", path, index, (int)faces.size());
+            return 1;
+        }
+        faceJson = faces[index].as<JsonObject>();
+    }
+    return CfNative::run(faceJson, runs, age, out);
+}
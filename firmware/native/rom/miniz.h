@@ -0,0 +1,84 @@
+// Stand-in for the ESP32 ROM's miniz: the tinfl streaming inflate calls
+// main.cpp makes, on top of the host's zlib (linked with -lz).
+#ifndef CF_MOCK_ROM_MINIZ_H
+#define CF_MOCK_ROM_MINIZ_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zlib.h>
+
+typedef unsigned char mz_uint8;
+typedef uint32_t mz_uint32;
+
+enum {
+    TINFL_FLAG_PARSE_ZLIB_HEADER = 1,
+    TINFL_FLAG_HAS_MORE_INPUT = 2,
+    TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF = 4,
+    TINFL_FLAG_COMPUTE_ADLER32 = 8
+};
+
+typedef enum {
+    TINFL_STATUS_BAD_PARAM = -3,
+    TINFL_STATUS_ADLER32_MISMATCH = -2,
+    TINFL_STATUS_FAILED = -1,
+    TINFL_STATUS_DONE = 0,
+    TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+    TINFL_STATUS_HAS_MORE_OUTPUT = 2
+} tinfl_status;
+
+#define TINFL_LZ_DICT_SIZE 32768
+
+// zlib keeps its own window, so the output ring is only written, never read
+// back for matches. live survives tinfl_init() (which, as in the ROM, only
+// resets m_state) so an abandoned stream's zlib state is freed on reuse.
+struct tinfl_decompressor {
+    int m_state; // 0 = header not yet seen, 1 = inflating, 2 = done
+    bool live;
+    z_stream z;
+};
+
+#define tinfl_init(r) do { (r)->m_state = 0; } while (0)
+
+inline tinfl_status tinfl_decompress(tinfl_decompressor* r, const mz_uint8* in, size_t* inSize,
+                                     mz_uint8* outStart, mz_uint8* outNext, size_t* outSize,
+                                     const mz_uint32 flags) {
+    size_t inCap = *inSize, outCap = *outSize;
+    *inSize = *outSize = 0;
+    bool wrapping = !(flags & TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+    size_t ring = (size_t)(outNext - outStart) + outCap;
+    if (wrapping && (ring & (ring - 1))) return TINFL_STATUS_BAD_PARAM;
+    if (r->m_state == 2) return TINFL_STATUS_DONE;
+
+    if (r->m_state == 0) {
+        if (inCap == 0) return TINFL_STATUS_NEEDS_MORE_INPUT;
+        // Like the ROM, refuse a stream whose window outgrows the ring
+        if ((flags & TINFL_FLAG_PARSE_ZLIB_HEADER) && wrapping && ((size_t)1 << (8 + (in[0] >> 4))) > ring) {
+            return TINFL_STATUS_FAILED;
+        }
+        if (r->live) inflateEnd(&r->z);
+        r->z = z_stream();
+        if (inflateInit2(&r->z, (flags & TINFL_FLAG_PARSE_ZLIB_HEADER) ? MAX_WBITS : -MAX_WBITS) != Z_OK) {
+            return TINFL_STATUS_FAILED;
+        }
+        r->live = true;
+        r->m_state = 1;
+    }
+
+    r->z.next_in = const_cast<mz_uint8*>(in);
+    r->z.avail_in = (uInt)inCap;
+    r->z.next_out = outNext;
+    r->z.avail_out = (uInt)outCap;
+    int ret = inflate(&r->z, Z_NO_FLUSH);
+    *inSize = inCap - r->z.avail_in;
+    *outSize = outCap - r->z.avail_out;
+    if (ret == Z_STREAM_END || (ret != Z_OK && ret != Z_BUF_ERROR)) {
+        inflateEnd(&r->z);
+        r->live = false;
+        r->m_state = ret == Z_STREAM_END ? 2 : 0;
+        return ret == Z_STREAM_END ? TINFL_STATUS_DONE : TINFL_STATUS_FAILED;
+    }
+    if (r->z.avail_out == 0) return TINFL_STATUS_HAS_MORE_OUTPUT;
+    return (flags & TINFL_FLAG_HAS_MORE_INPUT) ? TINFL_STATUS_NEEDS_MORE_INPUT : TINFL_STATUS_FAILED;
+}
+
+#endif
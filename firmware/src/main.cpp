@@ -6,8 +6,10 @@
 #include <SPIFFS.h>
 #include <HTTPClient.h>
 #include <WiFiClientSecure.h>
+#include <rom/miniz.h>
 #include "config.h"
 #include "fonts.h"
+#include "crispface_icons/WeatherIcons.h"
 
 // ---- RTC_DATA_ATTR state (persists across deep sleep) ----
 RTC_DATA_ATTR int  cfFaceIndex   = 0;
@@ -22,6 +24,14 @@ RTC_DATA_ATTR int  cfLastSyncTry  = 0;     // timestamp of last sync attempt (fo
 RTC_DATA_ATTR bool cfFaceChanging = false; // skip sync when cycling faces
 RTC_DATA_ATTR int  cfSyncFails    = 0;     // consecutive sync failures (for progressive backoff)
 RTC_DATA_ATTR int  cfLastWifiIdx  = -1;    // last successful WiFi network index (skip scan on reconnect)
+RTC_DATA_ATTR int  cfLastTimeSave = 0;     // timestamp last written to /last_time.txt
+// ETag of the sync response whose faces, interval and alerts are in place
+// ("" = none). RTC only: after a cold boot the alerts must be rebuilt from
+// a full response, so the first sync never asks for "not modified".
+RTC_DATA_ATTR char cfSyncEtag[40] = "";
+// Layout version of the faces on flash, sent so the server can answer with
+// a value-only delta ("" = none; RTC only, like cfSyncEtag)
+RTC_DATA_ATTR char cfSyncLayout[36] = "";
 
 // ---- Alert system ----
 struct CfAlert {
@@ -42,13 +52,779 @@ RTC_DATA_ATTR uint8_t cfNotifPreMin    = 0;
 RTC_DATA_ATTR char    cfNotifText[60]  = "";
 RTC_DATA_ATTR char    cfNotifTime[6]   = "";
 
+// ---- Compiled face format ----
+// syncFromServer() compiles each face's JSON once into /face_N.bin so the
+// minute tick can walk fixed-size records instead of parsing JSON:
+//   CfFaceHeader | CfCompRec[compCount] | string pool (NUL-terminated)
+// String fields hold byte offsets from the start of the record.
+#define CF_FACE_MAGIC     0x31464643  // "CFF1" little-endian
+#define CF_FACE_VERSION   4
+#define CF_MAX_COMPS      24
+#define CF_MAX_FACES      20  // faces past this in a sync response are skipped
+#define CF_FACE_MAX_BYTES 4096
+
+enum : uint8_t { CF_ALIGN_LEFT = 0, CF_ALIGN_CENTER, CF_ALIGN_RIGHT };
+enum : uint8_t { CF_COLOR_BLACK = 0, CF_COLOR_WHITE };
+
+// Complication kinds — local types are resolved at compile time so the
+// renderer never compares type/id strings
+enum : uint8_t {
+    CF_KIND_TEXT = 0,  // server value from the string pool
+    CF_KIND_ICON,      // server "icon:CODE[:SIZE]" → param = code, param2 = size
+    CF_KIND_TIME,      // param: 0 = horizontal, 1 = vertical
+    CF_KIND_DATE,
+    CF_KIND_VERSION,
+    CF_KIND_BATTERY,   // param: CF_BAT_*
+    CF_KIND_LOCAL,     // unknown local type — pool holds its name
+};
+enum : uint8_t { CF_BAT_ICON = 0, CF_BAT_PERCENT, CF_BAT_VOLTAGE };
+
+#define CF_COMP_BOLD  0x01
+#define CF_COMP_WHITE 0x02
+#define CF_COMP_LOCAL 0x04
+#define CF_COMP_DYNAMIC 0x08  // drawn every tick, not part of the static layer
+#define CF_COMP_UNDER   0x10  // static, but inside the per-tick region
+
+// What can change a complication's pixels between syncs. A window-only
+// wake re-resolves a complication only when its class has ticked since
+// the panel last showed it (see volKey()).
+enum : uint8_t {
+    CF_VOL_SYNC = 0,   // only a sync: text, icons, version, unknown locals
+    CF_VOL_MINUTE,     // time
+    CF_VOL_DAY,        // date
+    CF_VOL_BATTERY,    // battery: every CF_BATTERY_TICK seconds, or on (un)plug
+    CF_VOL_STALE,      // server text that turns stale (oblique) once
+};
+#define CF_BATTERY_TICK 600
+
+struct CfFaceHeader {
+    uint32_t magic;
+    uint16_t size;       // total record bytes (header + comps + pool)
+    uint8_t  version;
+    uint8_t  compCount;
+    uint8_t  bg;         // CF_COLOR_*
+    uint8_t  reserved[3];
+};
+
+struct CfCompRec {
+    int32_t  stale;      // seconds, <= 0 never expires
+    int16_t  x, y, w, h;
+    uint16_t value;      // pool offset of the value string
+    uint8_t  kind;       // CF_KIND_*
+    uint8_t  flags;      // CF_COMP_*
+    uint8_t  family;     // CfFontFamily
+    uint8_t  size;       // editor font size (12..72)
+    uint8_t  align;      // CF_ALIGN_*
+    uint8_t  param;      // kind-specific, see CF_KIND_*
+    uint8_t  param2;
+    uint8_t  bw, br, bp, pt, pl;
+    uint8_t  vol;        // CF_VOL_*
+    uint8_t  reserved;
+};
+
+static_assert(sizeof(CfFaceHeader) == 12, "CfFaceHeader layout changed");
+static_assert(sizeof(CfCompRec) == 28, "CfCompRec layout changed");
+
+// Records are read in place through CfFaceHeader/CfCompRec pointers, so
+// every buffer holding one is word-aligned (Xtensa faults on misaligned
+// 16- and 32-bit loads)
+alignas(4) static uint8_t cfFaceBuf[CF_FACE_MAX_BYTES]; // active face record
+alignas(4) static uint8_t cfPatchBuf[CF_FACE_MAX_BYTES]; // delta sync: record being rebuilt
+
+// ---- Static layer ----
+// After a sync each face's sync-stable complications (everything not
+// flagged CF_COMP_DYNAMIC) are rendered once and stored as /face_N.img:
+//   CfLayerHeader | 1bpp frame (cfFrame layout)
+// The header ties the image to the record it was rendered from.
+#define CF_LAYER_MAGIC 0x314C4643  // "CFL1" little-endian
+#define CF_LAYER_BYTES (200 / 8 * 200)
+
+struct CfLayerHeader {
+    uint32_t magic;
+    uint32_t faceHash;   // cfFaceFileHash() of the compiled record
+};
+
+// ---- Sync manifest ----
+// /sync.man records what the synced files hold, so a sync rewrites only
+// the files whose content changed. It is removed before the first changed
+// file is written and rewritten afterwards, so an interrupted sync leaves
+// no manifest and the next one writes everything.
+#define CF_MANIFEST_MAGIC 0x314D4643  // "CFM1" little-endian
+
+struct CfSyncManifest {
+    uint32_t magic;
+    uint32_t wifi;                     // cfHash() of the /wifi.json bytes
+    uint32_t faceCount;
+    uint32_t face[CF_MAX_FACES];       // cfFaceFileHash() of /face_N.bin + .img
+};
+
+// ---- Active face cache (RTC) ----
+// The compiled record for cfFaceIndex is kept in RTC slow memory so an
+// ordinary minute tick renders without mounting SPIFFS. It is trusted only
+// while cfRtcFaceGen matches cfFaceGen, which every successful sync bumps;
+// a face change or crash (RTC reset, index -1) reloads from flash. Records
+// larger than the cache are read from SPIFFS on every wake instead.
+#define CF_RTC_FACE_BYTES 2048
+alignas(4) RTC_DATA_ATTR uint8_t cfRtcFace[CF_RTC_FACE_BYTES];
+RTC_DATA_ATTR int      cfRtcFaceIdx = -1; // face index held in cfRtcFace
+RTC_DATA_ATTR uint32_t cfRtcFaceGen = 0;  // cfFaceGen when it was cached
+RTC_DATA_ATTR uint32_t cfFaceGen    = 0;  // bumped when synced faces are written
+
+// ---- Panel contents (dirty-rect refresh) ----
+// Hash of each complication as last pushed to the panel. A minute tick
+// only sends the union of complications whose hash changed; anything else
+// drawn to the panel (notification, menu, sync bar, debug) sets
+// cfPanelFace = -1 so the next face render pushes the whole frame.
+RTC_DATA_ATTR int      cfPanelFace = -1;  // face index currently on the panel
+RTC_DATA_ATTR uint32_t cfPanelGen  = 0;   // cfFaceGen of that face
+RTC_DATA_ATTR uint8_t  cfPanelComps = 0;
+RTC_DATA_ATTR uint32_t cfPanelHash[CF_MAX_COMPS];
+RTC_DATA_ATTR uint32_t cfPanelKey[CF_MAX_COMPS];  // volKey() when last resolved
+// cfHash() of the whole frame showWatchFace() last pushed, while the panel
+// still shows exactly that (0 = unknown). A wake whose whole frame hashes
+// the same skips the refresh; screens drawn straight to the display and
+// window pushes that change pixels reset it.
+RTC_DATA_ATTR uint32_t cfPanelFrame = 0;
+
+// ---- JSON arena ----
+// Every JsonDocument (one sync response element, wifi.json) lives in this
+// one static block, so sync never asks a fragmented heap for 16 KB. Only
+// one document can hold it at a time; a second gets no memory and its
+// parse fails with NoMemory. cfJsonPeak is the most any document has used
+// since reset.
+#ifndef CRISPFACE_JSON_ARENA
+#define CRISPFACE_JSON_ARENA 16384
+#endif
+alignas(8) static uint8_t cfJsonArena[CRISPFACE_JSON_ARENA]; // ArduinoJson's pool needs pointer alignment
+static bool    cfJsonArenaBusy = false;
+RTC_DATA_ATTR uint32_t cfJsonPeak = 0;
+
+struct CfArenaAllocator {
+    void* allocate(size_t n) {
+        if (cfJsonArenaBusy || n > sizeof(cfJsonArena)) return nullptr;
+        cfJsonArenaBusy = true;
+        return cfJsonArena;
+    }
+    void deallocate(void* p) {
+        if (p == cfJsonArena) cfJsonArenaBusy = false;
+    }
+    void* reallocate(void* p, size_t n) {
+        return n <= sizeof(cfJsonArena) ? p : nullptr;
+    }
+};
+
+struct CfJsonDoc : BasicJsonDocument<CfArenaAllocator> {
+    CfJsonDoc() : BasicJsonDocument<CfArenaAllocator>(CRISPFACE_JSON_ARENA) {}
+    ~CfJsonDoc() {
+        if (memoryUsage() > cfJsonPeak) cfJsonPeak = memoryUsage();
+    }
+};
+
+// ---- Inflate ----
+// A sync response sent with Content-Encoding: deflate (zlib) is inflated
+// by the ROM's miniz as it is read, into a ring the size of the server's
+// window. watch_faces.py compresses with a 4 KB window (DEFLATE_WBITS 12)
+// to match; a response declaring a larger one fails at its zlib header.
+#define CF_INFLATE_WINDOW 4096
+
+static tinfl_decompressor cfInflater;
+static uint8_t cfInflateRing[CF_INFLATE_WINDOW];
+static uint8_t cfInflateIn[512];
+
+// ---- Sync stream ----
+// The sync response is read straight off the socket, never held whole.
+// This walks its outer object and arrays a token at a time and hands each
+// element (one face, one value, one alert) to ArduinoJson on its own, so
+// the arena holds one face at a time however many the watch has. Any
+// malformed or truncated input sets bad; every step after that fails.
+class CfJsonStream : public Stream {
+public:
+    explicit CfJsonStream(WiFiClient& client) : c_(client) {}
+
+    size_t bytes = 0; // JSON bytes consumed so far
+    size_t wire = 0;  // body bytes received (compressed, if deflated)
+    bool bad = false;
+
+    // The body is zlib-compressed: inflate it from here on
+    void inflate() {
+        tinfl_init(&cfInflater);
+        z_ = true;
+    }
+    bool inflating() const { return z_; }
+
+    int available() override { return z_ ? (int)(head_ - tail_) : c_.available(); }
+    int peek() override {
+        if (!ready()) return -1;
+        return z_ ? cfInflateRing[tail_ % CF_INFLATE_WINDOW] : c_.peek();
+    }
+    int read() override {
+        if (!ready()) return -1;
+        bytes++;
+        if (z_) return cfInflateRing[tail_++ % CF_INFLATE_WINDOW];
+        wire++;
+        return c_.read();
+    }
+    size_t write(uint8_t) override { return 0; }
+
+    // Next non-whitespace character, left unread (-1 at the end of the body)
+    int next() {
+        int c;
+        while ((c = peek()) == ' ' || c == '\n' || c == '\r' || c == '\t') read();
+        return c;
+    }
+
+    bool expect(char ch) {
+        if (bad || next() != ch) return fail();
+        read();
+        return true;
+    }
+
+    // Steps to the next member or element inside an object or array whose
+    // opening bracket has been read. False once its closing bracket is
+    // consumed, or on bad input. n counts the items seen.
+    bool item(char close, int& n) {
+        if (bad) return false;
+        int c = next();
+        if (c == close) { read(); return false; }
+        if (n++ > 0) {
+            if (c != ',') return fail();
+            read();
+        }
+        return true;
+    }
+
+    // A string into buf, cut to cap-1 chars (the rest is still consumed)
+    bool readString(char* buf, size_t cap) {
+        if (!expect('"')) return false;
+        size_t n = 0;
+        for (;;) {
+            int c = read();
+            if (c < 0) return fail();
+            if (c == '"') break;
+            if (c == '\\') {
+                c = read();
+                if (c < 0) return fail();
+                if (c == 'n') c = '\n';
+                else if (c == 't') c = '\t';
+                else if (c == 'u') {
+                    for (int i = 0; i < 4; i++) if (read() < 0) return fail();
+                    c = '?';
+                }
+            }
+            if (n + 1 < cap) buf[n++] = (char)c;
+        }
+        if (cap) buf[n] = '\0';
+        return true;
+    }
+
+    // A member name and its colon
+    bool readKey(char* buf, size_t cap) { return readString(buf, cap) && expect(':'); }
+
+    // A number, true, false or null, as its text
+    bool readAtom(char* buf, size_t cap) {
+        size_t n = 0, len = 0;
+        int c = next();
+        while (c > 0 && (isalnum(c) || c == '-' || c == '+' || c == '.')) {
+            if (n + 1 < cap) buf[n++] = (char)c;
+            read();
+            len++;
+            c = peek();
+        }
+        if (cap) buf[n] = '\0';
+        return len > 0 || fail();
+    }
+
+    // Consumes one value of any kind without storing it
+    bool skipValue() {
+        int c = next();
+        if (c == '"') return readString(nullptr, 0);
+        if (c != '{' && c != '[') return readAtom(nullptr, 0);
+        int depth = 0;
+        do {
+            c = read();
+            if (c < 0) return fail();
+            if (c == '"') {
+                while ((c = read()) != '"') {
+                    if (c < 0) return fail();
+                    if (c == '\\') read();
+                }
+            } else if (c == '{' || c == '[') {
+                depth++;
+            } else if (c == '}' || c == ']') {
+                depth--;
+            }
+        } while (depth > 0);
+        return true;
+    }
+
+    bool fail() {
+        bad = true;
+        return false;
+    }
+
+private:
+    // Waits for the next byte until the HTTP timeout or the server closes
+    bool fill() {
+        unsigned long t = millis();
+        while (!c_.available()) {
+            if (!c_.connected() || millis() - t > CRISPFACE_HTTP_TIMEOUT) return false;
+            delay(1);
+        }
+        return true;
+    }
+
+    // True once a JSON byte is ready. Inflating, the ring is refilled only
+    // when every byte in it has been read, so nothing unread is overwritten.
+    bool ready() {
+        if (!z_) return fill();
+        while (tail_ == head_) {
+            if (zDone_) return false;
+            if (inPos_ == inLen_) {
+                if (!fill()) return false;
+                size_t n = c_.available();
+                if (n > sizeof(cfInflateIn)) n = sizeof(cfInflateIn);
+                inLen_ = c_.readBytes((char*)cfInflateIn, n);
+                inPos_ = 0;
+                wire += inLen_;
+            }
+            size_t inAvail = inLen_ - inPos_;
+            size_t off = head_ % CF_INFLATE_WINDOW;
+            size_t outAvail = CF_INFLATE_WINDOW - off;
+            tinfl_status st = tinfl_decompress(&cfInflater, cfInflateIn + inPos_, &inAvail,
+                                               cfInflateRing, cfInflateRing + off, &outAvail,
+                                               TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_HAS_MORE_INPUT);
+            inPos_ += inAvail;
+            head_ += outAvail;
+            if (st == TINFL_STATUS_DONE) zDone_ = true;
+            else if (st < 0) return fail();
+        }
+        return true;
+    }
+
+    WiFiClient& c_;
+    bool z_ = false;
+    bool zDone_ = false;
+    size_t head_ = 0, tail_ = 0;   // ring bytes inflated / read
+    size_t inPos_ = 0, inLen_ = 0; // compressed bytes in cfInflateIn
+};
+
+// ---- Frame canvas ----
+// Faces, notifications and the fallback screen are drawn into this 1bpp
+// frame instead of the display (GxEPD2 keeps its buffer private). The
+// layout matches the GxEPD2 buffer — 1 = white, MSB = leftmost pixel — so
+// showWatchFace() can push it, or just its dirty window, straight to the
+// panel. Spans and glyphs are written a byte at a time.
+class CfCanvas : public Adafruit_GFX {
+public:
+    static const int16_t W = 200;
+    static const int16_t H = 200;
+    static const int16_t STRIDE = W / 8;
+
+    CfCanvas() : Adafruit_GFX(W, H) {}
+
+    uint8_t* buffer() { return buf; }
+
+#ifdef CRISPFACE_NATIVE
+    uint32_t pixelCalls = 0; // drawPixel() calls, read by native/bench.cpp
+#endif
+
+    // Colour semantics follow GxEPD2_BW: only GxEPD_WHITE sets a bit
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+#ifdef CRISPFACE_NATIVE
+        pixelCalls++;
+#endif
+        if (x < 0 || y < 0 || x >= W || y >= H) return;
+        uint8_t* p = &buf[y * STRIDE + (x >> 3)];
+        if (color == GxEPD_WHITE) *p |= 0x80 >> (x & 7);
+        else                      *p &= ~(0x80 >> (x & 7));
+    }
+
+    void fillScreen(uint16_t color) override {
+        memset(buf, color == GxEPD_BLACK ? 0x00 : 0xFF, sizeof(buf));
+    }
+
+    // Same pixels as Adafruit_GFX's writeLine()-based defaults
+    // (including their handling of zero/negative lengths), as byte spans
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+        int x1 = x + w - 1;
+        if (x1 < x) hspan(x1, x, y, color);
+        else        hspan(x, x1, y, color);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+        int y0 = y, y1 = y + h - 1;
+        if (y1 < y0) { int t = y0; y0 = y1; y1 = t; }
+        if (x < 0 || x >= W) return;
+        if (y0 < 0) y0 = 0;
+        if (y1 >= H) y1 = H - 1;
+        uint8_t m = 0x80 >> (x & 7);
+        uint8_t* p = &buf[y0 * STRIDE + (x >> 3)];
+        for (int yy = y0; yy <= y1; yy++, p += STRIDE) {
+            if (color == GxEPD_WHITE) *p |= m;
+            else                      *p &= ~m;
+        }
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+        if (w <= 0) return;
+        int y0 = y, y1 = y + h - 1;
+        if (y1 < y0) { int t = y0; y0 = y1; y1 = t; }
+        vbar(x, x + w - 1, y0, y1 + 1, color);
+    }
+
+    // Same pixels as Adafruit_GFX's Bresenham writeLine(), which its
+    // drawLine() and the outline shapes use, as one span per row
+    void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override {
+        drawThickLine(x0, y0, x1, y1, 1, color);
+    }
+
+    // The line from (x0, y0) to (x1, y1) together with its copies shifted
+    // 1..t-1 pixels right, the way icon strokes are thickened. Each row the
+    // line crosses is one span from its leftmost pixel to t-1 past its
+    // rightmost.
+    void drawThickLine(int x0, int y0, int x1, int y1, int t, uint16_t color) {
+        bool steep = abs(y1 - y0) > abs(x1 - x0);
+        if (steep) { int a = x0; x0 = y0; y0 = a; a = x1; x1 = y1; y1 = a; }
+        if (x0 > x1) { int a = x0; x0 = x1; x1 = a; a = y0; y0 = y1; y1 = a; }
+        int dx = x1 - x0, dy = abs(y1 - y0);
+        int err = dx / 2;
+        int ystep = y0 < y1 ? 1 : -1;
+        int row = steep ? x0 : y0;
+        int lo = steep ? y0 : x0, hi = lo;
+        for (; x0 <= x1; x0++) {
+            int px = steep ? y0 : x0;
+            int py = steep ? x0 : y0;
+            if (py != row) {
+                hspan(lo, hi + t - 1, row, color);
+                row = py;
+                lo = hi = px;
+            }
+            if (px < lo) lo = px;
+            if (px > hi) hi = px;
+            err -= dy;
+            if (err < 0) { y0 += ystep; err += dx; }
+        }
+        hspan(lo, hi + t - 1, row, color);
+    }
+
+    // Same pixels as Adafruit_GFX::fillCircle() (which is not virtual, so
+    // this hides it), one span per row
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+        if (r < 0 || r > MAX_R) {
+            Adafruit_GFX::fillCircle(x0, y0, r, color);
+            return;
+        }
+        int16_t ext[MAX_R + 1];
+        circleExtents(r, ext);
+        for (int d = 0; d <= r; d++) {
+            hspan(x0 - ext[d], x0 + ext[d], y0 - d, color);
+            if (d) hspan(x0 - ext[d], x0 + ext[d], y0 + d, color);
+        }
+    }
+
+    // A bw-pixel border inside the rounded rectangle (x, y, w, h, r): each
+    // row of fillRoundRect(x, y, w, h, r) less the same row of the
+    // rectangle inset by bw with radius r - bw, as one or two spans. r = 0
+    // is a square-cornered border.
+    void drawRoundFrame(int x, int y, int w, int h, int r, int bw, uint16_t color) {
+        if (w <= 0 || h <= 0 || bw <= 0) return;
+        int maxR = (w < h ? w : h) / 2;
+        if (r > maxR) r = maxR;
+        if (r > MAX_R) r = MAX_R;
+        if (r < 0) r = 0;
+        int ix = x + bw, iy = y + bw, iw = w - 2 * bw, ih = h - 2 * bw;
+        bool hollow = iw > 0 && ih > 0;
+        int ir = r - bw;
+        if (ir < 0) ir = 0;
+        if (hollow && ir > (iw < ih ? iw : ih) / 2) ir = (iw < ih ? iw : ih) / 2;
+
+        int16_t ext[MAX_R + 1], iext[MAX_R + 1];
+        circleExtents(r, ext);
+        if (hollow) circleExtents(ir, iext);
+
+        // Rows clear of every corner are the same two spans: fill them as
+        // two bars and walk only the rows above and below
+        int bandY0 = -1, bandY1 = -1;
+        if (hollow) {
+            bandY0 = y + r > iy + ir ? y + r : iy + ir;
+            bandY1 = y + h - r < iy + ih - ir ? y + h - r : iy + ih - ir;
+            if (bandY0 < 0) bandY0 = 0;
+            if (bandY1 > H) bandY1 = H;
+            if (bandY1 > bandY0) {
+                vbar(x + r - ext[0], ix + ir - iext[0] - 1, bandY0, bandY1, color);
+                vbar(ix + iw - ir + iext[0], x + w - r - 1 + ext[0], bandY0, bandY1, color);
+            } else {
+                bandY0 = bandY1 = -1;
+            }
+        }
+        int y0 = y > 0 ? y : 0;
+        int y1 = y + h < H ? y + h : H;
+        for (int yy = y0; yy < y1; yy++) {
+            if (yy == bandY0) { yy = bandY1 - 1; continue; }
+            int ox0, ox1;
+            roundRectRow(x, y, w, h, r, ext, yy, ox0, ox1);
+            if (!hollow || yy < iy || yy >= iy + ih) {
+                hspan(ox0, ox1, yy, color);
+                continue;
+            }
+            int ix0, ix1;
+            roundRectRow(ix, iy, iw, ih, ir, iext, yy, ix0, ix1);
+            hspan(ox0, ix0 - 1, yy, color);
+            hspan(ix1 + 1, ox1, yy, color);
+        }
+    }
+
+    // Draws character `c` of a GFX font with its origin (pen x, baseline)
+    // at (x, y), clipped to the box (cx, cy, cw, ch). The box is clipped
+    // once per glyph; each row is then written as whole source bytes, with
+    // a straight copy when source and destination are byte-aligned (Tamzen
+    // glyphs are multiples of 8 wide). `skew` shears rows right, most at
+    // the top, for stale text in a font with no linked oblique variant.
+    // `scale` > 1 draws a glyph stored at base resolution with every pixel
+    // as a scale x scale block (the 2x/3x/4x Tamzen sizes, see
+    // GFXMetrics::scale).
+    void drawGlyph(const GFXfont* font, uint8_t c, int x, int y, uint16_t color,
+                   int cx, int cy, int cw, int ch, int skew = 0, int scale = 1) {
+        const GFXglyph* g = &font->glyph[c - font->first];
+        int gw = g->width;
+        int gh = g->height;
+        if (gw == 0 || gh == 0) return;
+
+        int clipX0 = cx > 0 ? cx : 0;
+        int clipY0 = cy > 0 ? cy : 0;
+        int clipX1 = cx + cw < W ? cx + cw : W;
+        int clipY1 = cy + ch < H ? cy + ch : H;
+        if (scale > 1) {
+            drawScaledGlyph(font, g, x, y, color, clipX0, clipY0, clipX1, clipY1, skew, scale);
+            return;
+        }
+        int gx = x + g->xOffset;
+        int gy = y + g->yOffset;
+        int r0 = clipY0 - gy > 0 ? clipY0 - gy : 0;
+        int r1 = clipY1 - gy < gh ? clipY1 - gy : gh;
+        if (r0 >= r1 || gx + gw + skew <= clipX0 || gx >= clipX1) return;
+
+        const uint8_t* bm = font->bitmap + g->bitmapOffset;
+        bool white = (color == GxEPD_WHITE);
+
+        for (int r = r0; r < r1; r++) {
+            int dx = gx + (skew ? (gh - r) * skew / gh : 0);
+            int c0 = clipX0 - dx > 0 ? clipX0 - dx : 0;
+            int c1 = clipX1 - dx < gw ? clipX1 - dx : gw;
+            if (c0 >= c1) continue;
+
+            uint8_t* row = &buf[(gy + r) * STRIDE];
+            uint32_t bitPos = (uint32_t)r * gw + c0;
+            int px = dx + c0;
+            int n = c1 - c0;
+
+            if (!(bitPos & 7) && !(px & 7)) {
+                const uint8_t* src = bm + (bitPos >> 3);
+                uint8_t* dst = row + (px >> 3);
+                for (; n > 0; n -= 8) {
+                    uint8_t b = pgm_read_byte(src++);
+                    if (n < 8) b &= (uint8_t)(0xFF00 >> n);
+                    if (white) *dst++ |= b;
+                    else       *dst++ &= ~b;
+                }
+                continue;
+            }
+            while (n > 0) {
+                int k = n < 8 ? n : 8;
+                putBits(row, px, readBits(bm, bitPos, k), white);
+                bitPos += k;
+                px += k;
+                n -= k;
+            }
+        }
+    }
+
+private:
+    uint8_t buf[STRIDE * H];
+
+    static const int MAX_R = W / 2; // largest radius the span shapes take
+
+    // ext[d] = how far row d above or below a circle's centre reaches, for
+    // the circle Adafruit_GFX's fillCircleHelper() draws. That draws column
+    // c of the quadrant with some half-height; ext[d] is the outermost
+    // column whose half-height is at least d.
+    static void circleExtents(int r, int16_t* ext) {
+        int16_t colH[MAX_R + 1];
+        for (int c = 0; c <= r; c++) colH[c] = -1;
+        colH[0] = r; // centre column (fillCircle) or middle fillRect (fillRoundRect)
+        int f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r, px = x, py = y;
+        while (x < y) {
+            if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+            x++; ddF_x += 2; f += ddF_x;
+            if (x < y + 1 && y > colH[x]) colH[x] = y;
+            if (y != py) {
+                if (px > colH[py]) colH[py] = px;
+                py = y;
+            }
+            px = x;
+        }
+        for (int d = 0, c = r; d <= r; d++) {
+            while (colH[c] < d) c--;
+            ext[d] = c;
+        }
+    }
+
+    // Left and right pixel of row yy of fillRoundRect(x, y, w, h, r)
+    static void roundRectRow(int x, int y, int w, int h, int r, const int16_t* ext,
+                             int yy, int& x0, int& x1) {
+        int d = 0;
+        if (yy < y + r) d = y + r - yy;
+        else if (yy > y + h - r - 1) d = yy - (y + h - r - 1);
+        x0 = x + r - ext[d];
+        x1 = x + w - r - 1 + ext[d];
+    }
+
+    // Each run of set source pixels in a glyph row becomes one span on
+    // each of the `s` destination rows it covers; the source bitmap is
+    // read once per glyph whatever the scale. Rows shear by the same
+    // (height - row) * skew / height as an unscaled glyph of full size.
+    void drawScaledGlyph(const GFXfont* font, const GFXglyph* g, int x, int y,
+                         uint16_t color, int clipX0, int clipY0, int clipX1,
+                         int clipY1, int skew, int s) {
+        int gw = g->width;
+        int sh = g->height * s;
+        int gx = x + g->xOffset * s;
+        int gy = y + g->yOffset * s;
+        int R0 = clipY0 - gy > 0 ? clipY0 - gy : 0;
+        int R1 = clipY1 - gy < sh ? clipY1 - gy : sh;
+        if (R0 >= R1 || gx + gw * s + skew <= clipX0 || gx >= clipX1) return;
+
+        const uint8_t* bm = font->bitmap + g->bitmapOffset;
+        for (int r = R0 / s; r * s < R1; r++) {
+            int ra = r * s > R0 ? r * s : R0;
+            int rb = r * s + s < R1 ? r * s + s : R1;
+            uint32_t pos = (uint32_t)r * gw;
+            int col = 0;
+            while (col < gw) {
+                while (col < gw && !srcBit(bm, pos + col)) col++;
+                int start = col;
+                while (col < gw && srcBit(bm, pos + col)) col++;
+                if (col == start) break;
+                for (int R = ra; R < rb; R++) {
+                    int dx = gx + (skew ? (sh - R) * skew / sh : 0);
+                    int x0 = dx + start * s;
+                    int x1 = dx + col * s;
+                    if (x0 < clipX0) x0 = clipX0;
+                    if (x1 > clipX1) x1 = clipX1;
+                    if (x0 < x1) hspan(x0, x1 - 1, gy + R, color);
+                }
+            }
+        }
+    }
+
+    static bool srcBit(const uint8_t* bm, uint32_t pos) {
+        return pgm_read_byte(bm + (pos >> 3)) & (0x80 >> (pos & 7));
+    }
+
+    void hspan(int x0, int x1, int y, uint16_t color) {
+        if (y < 0 || y >= H) return;
+        if (x0 < 0) x0 = 0;
+        if (x1 >= W) x1 = W - 1;
+        if (x0 > x1) return;
+        uint8_t* row = &buf[y * STRIDE];
+        int b0 = x0 >> 3, b1 = x1 >> 3;
+        uint8_t m0 = 0xFF >> (x0 & 7);
+        uint8_t m1 = 0xFF << (7 - (x1 & 7));
+        bool white = (color == GxEPD_WHITE);
+        if (b0 == b1) {
+            uint8_t m = m0 & m1;
+            if (white) row[b0] |= m; else row[b0] &= ~m;
+            return;
+        }
+        if (white) {
+            row[b0] |= m0;
+            memset(row + b0 + 1, 0xFF, b1 - b0 - 1);
+            row[b1] |= m1;
+        } else {
+            row[b0] &= ~m0;
+            memset(row + b0 + 1, 0x00, b1 - b0 - 1);
+            row[b1] &= ~m1;
+        }
+    }
+
+    // Columns x0..x1 of rows y0..y1-1, the byte masks worked out once
+    void vbar(int x0, int x1, int y0, int y1, uint16_t color) {
+        if (x0 < 0) x0 = 0;
+        if (x1 >= W) x1 = W - 1;
+        if (y0 < 0) y0 = 0;
+        if (y1 > H) y1 = H;
+        if (x0 > x1 || y0 >= y1) return;
+        int b0 = x0 >> 3, b1 = x1 >> 3;
+        uint8_t m0 = 0xFF >> (x0 & 7);
+        uint8_t m1 = 0xFF << (7 - (x1 & 7));
+        if (b0 == b1) m0 = m1 = m0 & m1;
+        bool white = (color == GxEPD_WHITE);
+        for (uint8_t* row = &buf[y0 * STRIDE]; y0 < y1; y0++, row += STRIDE) {
+            if (white) {
+                row[b0] |= m0;
+                if (b1 > b0) {
+                    memset(row + b0 + 1, 0xFF, b1 - b0 - 1);
+                    row[b1] |= m1;
+                }
+            } else {
+                row[b0] &= ~m0;
+                if (b1 > b0) {
+                    memset(row + b0 + 1, 0x00, b1 - b0 - 1);
+                    row[b1] &= ~m1;
+                }
+            }
+        }
+    }
+
+    // Top k (1..8) bits of a glyph bitmap starting at bit `pos`
+    static uint8_t readBits(const uint8_t* bm, uint32_t pos, int k) {
+        const uint8_t* p = bm + (pos >> 3);
+        int sh = pos & 7;
+        uint8_t b = pgm_read_byte(p) << sh;
+        if (sh + k > 8) b |= pgm_read_byte(p + 1) >> (8 - sh);
+        return b & (uint8_t)(0xFF00 >> k);
+    }
+
+    // ORs (white) or clears (black) the set bits of `bits` at pixel x
+    static void putBits(uint8_t* row, int x, uint8_t bits, bool white) {
+        uint16_t m = ((uint16_t)bits << 8) >> (x & 7);
+        uint8_t* d = row + (x >> 3);
+        if (white) {
+            d[0] |= m >> 8;
+            if (m & 0xFF) d[1] |= m & 0xFF;
+        } else {
+            d[0] &= ~(m >> 8);
+            if (m & 0xFF) d[1] &= ~(m & 0xFF);
+        }
+    }
+};
+
+static CfCanvas cfFrame;
+
 class CrispFace : public Watchy {
+#ifdef CRISPFACE_NATIVE
+    friend struct CfNative; // native/render.cpp and bench.cpp drive the renderer on a host
+#endif
 public:
     String cfDebugWifi; // WiFi debug log, populated by cfConnectWiFi()
+    bool cfFsMounted = false;
+    // Region of the frame that differs from the panel, set by renderFace()
+    bool cfDirtyFull = true;
+    int  cfDirtyX0, cfDirtyY0, cfDirtyX1, cfDirtyY1; // exclusive x1/y1
     bool cfDismissing = false; // skip sync/alerts during notification dismiss redraw
+    bool cfSelfPresent = false; // showWatchFace() pushes cfFrame itself
+    bool cfPanelBar = false;    // sync bar drawn over the panel's last frame
+    bool cfPushWindow = false;  // this frame may be pushed as a dirty window
 
     CrispFace(const watchySettings &s) : Watchy(s) {}
 
+    // Mount SPIFFS on first use — it's unmounted after deep sleep, and a
+    // minute tick served from the RTC face cache never needs it
+    bool cfMountFS() {
+        if (!cfFsMounted) cfFsMounted = SPIFFS.begin(true);
+        return cfFsMounted;
+    }
+
     // Progressive backoff: 0→0s, 1→15min, 2→30min, 3+→1hr
     int cfBackoffSeconds() {
         if (cfSyncFails <= 0) return 0;
@@ -57,22 +833,88 @@ public:
         return 3600;
     }
 
+    // Minute ticks on the watch face are handled here so they go through
+    // CrispFace::showWatchFace() — Watchy::init() calls the stock,
+    // non-virtual showWatchFace(), which always pushes the full frame.
+    // Button wakes, menu ticks and reset still use the stock init. The
+    // minute tick allocates nothing: no String is built unless handing off.
+    void init(const char* datetime = "") {
+        if (esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_TIMER
+            || guiState != WATCHFACE_STATE) {
+            Watchy::init(String(datetime));
+            return;
+        }
+        Wire.begin(WATCHY_V3_SDA, WATCHY_V3_SCL);
+        RTC.init();
+        display.epd2.initWatchy();
+        RTC.read(currentTime);
+        showWatchFace(true);
+        if (settings.vibrateOClock && currentTime.Minute == 0) {
+            vibMotor(75, 4);
+        }
+        deepSleep();
+    }
+
+    // Draws the frame, then pushes only the region renderFace() marked
+    // dirty. A full refresh, or any screen other than a face, pushes the
+    // whole frame as before, unless it is the frame already on the panel.
+    // drawImage()/drawImagePart() write cfFrame straight to the controller
+    // and refresh, bypassing the display buffer.
+    void showWatchFace(bool partialRefresh) {
+        cfDirtyFull = true;
+        cfSelfPresent = true;
+        cfPushWindow = partialRefresh;
+        cfPanelBar = false;
+        display.setFullWindow();
+        drawWatchFace();
+        cfSelfPresent = false;
+        cfPushWindow = false;
+        const uint8_t* frame = cfFrame.buffer();
+        uint32_t frameHash = 0;
+        if (cfDirtyFull) frameHash = cfHash(frame, CF_LAYER_BYTES);
+        if (!partialRefresh) {
+            copyFrameToDisplay();
+            display.display(false);
+            cfPanelFrame = frameHash;
+        } else if (cfDirtyFull && frameHash == cfPanelFrame) {
+            // Same pixels as the panel; only a sync bar needs wiping
+            if (cfPanelBar) display.drawImagePart(frame, 0, 196, 200, 200, 0, 196, 200, 4);
+        } else if (cfDirtyFull) {
+            display.drawImage(frame, 0, 0, 200, 200);
+            cfPanelFrame = frameHash;
+        } else if (cfDirtyX1 > cfDirtyX0 && cfDirtyY1 > cfDirtyY0) {
+            // Controller windows must start and end on a byte boundary
+            int x0 = cfDirtyX0 & ~7;
+            int x1 = (cfDirtyX1 + 7) & ~7;
+            display.drawImagePart(frame, x0, cfDirtyY0, 200, 200,
+                                  x0, cfDirtyY0, x1 - x0, cfDirtyY1 - cfDirtyY0);
+            cfPanelFrame = 0; // only the window is known
+        }
+        // else: nothing on the face changed, leave the panel alone
+        cfPanelBar = false;
+        guiState = WATCHFACE_STATE;
+    }
+
+    // Watchy's own showWatchFace() (reset, USB, menu exit) pushes the
+    // display buffer after this returns, so hand it the frame
     void drawWatchFace() {
+        drawFrame();
+        if (!cfSelfPresent) {
+            copyFrameToDisplay();
+            cfPanelFrame = 0; // pushed by Watchy, maybe after a menu
+        }
+    }
+
+    void copyFrameToDisplay() {
+        display.drawBitmap(0, 0, cfFrame.buffer(), 200, 200, GxEPD_WHITE, GxEPD_BLACK);
+    }
+
+    void drawFrame() {
         // Restore timezone after deep sleep (RAM is wiped, TZ env var lost).
         // Watchy32KRTC::read() uses localtime_r() which needs TZ set correctly.
         configTime(CRISPFACE_GMT_OFFSET * 3600, 0, "");
         RTC.read(currentTime);
 
-        // Mount SPIFFS every wake — it's unmounted after deep sleep
-        if (!SPIFFS.begin(true)) {
-            display.fillScreen(GxEPD_WHITE);
-            display.setTextColor(GxEPD_BLACK);
-            display.setFont(NULL);
-            display.setCursor(10, 100);
-            display.print("SPIFFS failed");
-            return;
-        }
-
         // Seed RTC from build timestamp after flash or hard crash.
         // ESP32-S3 has no external RTC — internal clock resets on hard reset.
         // cfTimeSeeded is false after flash/crash (RTC_DATA_ATTR resets to 0),
@@ -81,11 +923,14 @@ public:
         if (!cfTimeSeeded) {
             // Try to recover last-known time from SPIFFS (more recent than build epoch)
             time_t seedTime = CRISPFACE_BUILD_EPOCH;
-            File tf = SPIFFS.open("/last_time.txt", "r");
+            File tf;
+            if (cfMountFS()) tf = SPIFFS.open("/last_time.txt", "r");
             if (tf) {
-                String ts = tf.readStringUntil('\n');
+                char ts[16];
+                size_t n = tf.readBytesUntil('\n', ts, sizeof(ts) - 1);
+                ts[n] = 0;
                 tf.close();
-                time_t saved = (time_t)ts.toInt();
+                time_t saved = (time_t)atol(ts);
                 if (saved > seedTime) seedTime = saved;
             }
             struct timeval tv;
@@ -100,28 +945,25 @@ public:
 
         // Save current time to SPIFFS periodically so crash recovery
         // uses a recent timestamp instead of the (potentially old) build epoch.
-        // Only write every ~10 min to reduce flash wear.
+        // Only write every ~10 min to reduce flash wear; the last write time
+        // is tracked in RTC so other ticks don't touch flash at all.
         {
             int nowCheck = makeTime(currentTime);
-            File tf = SPIFFS.open("/last_time.txt", "r");
-            bool needsWrite = true;
-            if (tf) {
-                String ts = tf.readStringUntil('\n');
-                tf.close();
-                int saved = ts.toInt();
-                if (saved > 0 && (nowCheck - saved) < 600) needsWrite = false;
-            }
-            if (needsWrite) {
-                File wf = SPIFFS.open("/last_time.txt", "w");
-                if (wf) { wf.println(nowCheck); wf.close(); }
+            if (cfLastTimeSave <= 0 || (nowCheck - cfLastTimeSave) >= 600
+                || nowCheck < cfLastTimeSave) {
+                if (cfMountFS()) {
+                    File wf = SPIFFS.open("/last_time.txt", "w");
+                    if (wf) { wf.println(nowCheck); wf.close(); }
+                }
+                cfLastTimeSave = nowCheck;
             }
         }
 
         // If RTC was lost (e.g. hard crash), check SPIFFS for cached faces
-        if (cfFaceCount == 0) {
-            for (int i = 0; i < 20; i++) {
+        if (cfFaceCount == 0 && cfMountFS()) {
+            for (int i = 0; i < CF_MAX_FACES; i++) {
                 char path[24];
-                snprintf(path, sizeof(path), "/face_%d.json", i);
+                snprintf(path, sizeof(path), "/face_%d.bin", i);
                 if (SPIFFS.exists(path)) {
                     cfFaceCount = i + 1;
                 } else {
@@ -141,9 +983,7 @@ public:
             // Fall through to render the first synced face
             if (cfFaceCount > 0) {
                 cfFaceIndex = 0;
-                char path[32];
-                snprintf(path, sizeof(path), "/face_%d.json", cfFaceIndex);
-                renderFace(path);
+                renderFace(cfFaceIndex);
             } else {
                 renderFallback();
             }
@@ -235,14 +1075,12 @@ public:
         cfDismissing = false;
         cfFaceChanging = false;
 
-        // Render current face from SPIFFS
+        // Render current face (RTC cache, else SPIFFS)
         if (cfFaceCount > 0) {
             if (cfFaceIndex >= cfFaceCount) cfFaceIndex = 0;
             if (cfFaceIndex < 0) cfFaceIndex = cfFaceCount - 1;
 
-            char path[32];
-            snprintf(path, sizeof(path), "/face_%d.json", cfFaceIndex);
-            renderFace(path);
+            renderFace(cfFaceIndex);
         } else {
             renderFallback();
         }
@@ -253,6 +1091,8 @@ public:
 
         // When in a menu/app, let the stock Watchy code handle everything
         if (guiState != WATCHFACE_STATE) {
+            cfPanelFace = -1; // menus draw over the face
+            cfPanelFrame = 0;
             Watchy::handleButtonPress();
             return;
         }
@@ -274,6 +1114,8 @@ public:
         // Watchface state — our custom button handling
         if (wakeupBit & MENU_BTN_MASK) {
             cfFaceChanging = true; // skip sync when returning from menu
+            cfPanelFace = -1;
+            cfPanelFrame = 0;
             Watchy::handleButtonPress(); // opens stock menu
         }
         else if (wakeupBit & UP_BTN_MASK) {
@@ -321,102 +1163,112 @@ private:
 
     // ---- Word wrap helper ----
 
-    // Wraps text to fit within maxW pixels using the given font.
-    // Inserts '\n' at word boundaries. Existing '\n' are preserved.
+    // Wraps text to fit within maxW pixels using the given font, in one
+    // pass: glyph advances are summed while scanning and the last space on
+    // the line is kept as the break point. A word wider than maxW is broken
+    // at the last character that fits. Existing '\n' are preserved.
+    // Line-start markers (see drawAligned) are understood: \x04 dividers
+    // are never wrapped, a \x01/\x02 circle counts its drawn width, and a
+    // \x03 bold line repeats the marker on each wrapped continuation.
     void wordWrap(const char* text, char* out, int outSize, int maxW, const GFXfont* font) {
-        display.setFont(font);
-        int16_t tx, ty;
-        uint16_t tw, th;
+        GFXMetrics fm = fontMetrics(font);
+        int circleW = (fm.ascent / 4) * 2 + 3;  // as drawn by drawAligned()
+        const char* brk = "\n\x03";
+        int o = 0;
+        const char* p = text;
+
+        while (*p && o < outSize - 1) {
+            const char* eol = strchr(p, '\n');
+            if (!eol) eol = p + strlen(p);
+
+            if ((uint8_t)*p == 0x04) {
+                // Day divider: a single line, never wrapped
+                while (p < eol && o < outSize - 1) out[o++] = *p++;
+            } else {
+                bool bold = (uint8_t)*p == 0x03;
+                if (bold) out[o++] = *p++;
+                int brkLen = bold ? 2 : 1;
+                int w = 0;
+                if (((uint8_t)*p == 0x01 || (uint8_t)*p == 0x02) && o < outSize - 1) {
+                    out[o++] = *p++;
+                    if (*p == ' ' && o < outSize - 1) out[o++] = *p++;
+                    w = circleW;
+                }
 
-        int outIdx = 0;
-        int i = 0;
-        int len = strlen(text);
-
-        while (i < len && outIdx < outSize - 1) {
-            // Find end of this input line (up to next \n or end)
-            int lineEnd = i;
-            while (lineEnd < len && text[lineEnd] != '\n') lineEnd++;
-
-            // Word-wrap this segment
-            int segStart = i;
-            while (segStart < lineEnd && outIdx < outSize - 1) {
-                // Find how many chars fit within maxW
-                int lastSpace = -1;
-                int fitEnd = segStart;
-
-                // Measure incrementally word by word
-                for (int j = segStart; j <= lineEnd; j++) {
-                    if (j == lineEnd || text[j] == ' ') {
-                        // Measure segStart..j
-                        char tmp[64];
-                        int tmpLen = j - segStart;
-                        if (tmpLen >= (int)sizeof(tmp)) tmpLen = sizeof(tmp) - 1;
-                        memcpy(tmp, text + segStart, tmpLen);
-                        tmp[tmpLen] = '\0';
-                        display.getTextBounds(tmp, 0, 0, &tx, &ty, &tw, &th);
-                        if ((int)tw <= maxW) {
-                            fitEnd = j;
-                            if (text[j] == ' ') lastSpace = j;
-                        } else {
-                            break;
+                int lineStart = o;    // first text byte of the current output line
+                int space = -1;       // output index of the last space on it
+                int wToSpace = 0;     // line width up to and including that space
+                for (; p < eol && o < outSize - 1; p++) {
+                    uint8_t c = (uint8_t)*p;
+                    int adv = measureText(font, p, 1);
+                    if (w + adv > maxW && o > lineStart) {
+                        if (c == ' ') {
+                            // Break at this space and drop it
+                            o = wrapInsert(out, outSize, o, o, brk, brkLen);
+                            lineStart = o;
+                            space = -1;
+                            w = 0;
+                            continue;
+                        }
+                        if (space >= 0) {
+                            // Break at the last space; the partial word moves down
+                            out[space] = '\n';
+                            if (bold) o = wrapInsert(out, outSize, o, space + 1, brk + 1, 1);
+                            lineStart = space + brkLen;
+                            w -= wToSpace;
+                            space = -1;
                         }
+                        if (w + adv > maxW && o > lineStart) {
+                            // Word wider than the line — break it here
+                            o = wrapInsert(out, outSize, o, o, brk, brkLen);
+                            lineStart = o;
+                            w = 0;
+                        }
+                        if (o >= outSize - 1) break;
                     }
-                }
-
-                int copyEnd;
-                int nextStart;
-                if (fitEnd >= lineEnd) {
-                    // Whole remaining segment fits
-                    copyEnd = lineEnd;
-                    nextStart = lineEnd;
-                } else if (lastSpace > segStart) {
-                    // Break at last space that fit
-                    copyEnd = lastSpace;
-                    nextStart = lastSpace + 1; // skip the space
-                } else {
-                    // No space found — force break at fitEnd (or at least 1 char)
-                    copyEnd = fitEnd > segStart ? fitEnd : segStart + 1;
-                    nextStart = copyEnd;
-                }
-
-                int copyLen = copyEnd - segStart;
-                if (outIdx + copyLen >= outSize - 1) copyLen = outSize - 1 - outIdx;
-                memcpy(out + outIdx, text + segStart, copyLen);
-                outIdx += copyLen;
-
-                segStart = nextStart;
-                // Add newline if more text follows in this segment
-                if (segStart < lineEnd && outIdx < outSize - 1) {
-                    out[outIdx++] = '\n';
+                    if (c == ' ' && o > lineStart) {
+                        space = o;
+                        wToSpace = w + adv;
+                    }
+                    out[o++] = (char)c;
+                    w += adv;
                 }
             }
 
-            // Preserve original \n (move past it)
-            i = lineEnd;
-            if (i < len && text[i] == '\n') {
-                if (outIdx < outSize - 1) out[outIdx++] = '\n';
-                i++;
+            p = eol;
+            if (*p == '\n') {
+                if (o < outSize - 1) out[o++] = '\n';
+                p++;
             }
         }
-        out[outIdx] = '\0';
+        out[o] = '\0';
+    }
+
+    // Inserts `n` bytes at out[at] of a string of length `len`, dropping
+    // whatever no longer fits in outSize - 1. Returns the new length.
+    static int wrapInsert(char* out, int outSize, int len, int at, const char* ins, int n) {
+        int room = outSize - 1 - at;
+        if (n > room) n = room;
+        int keep = len - at;
+        if (keep > room - n) keep = room - n;
+        memmove(out + at + n, out + at, keep);
+        memcpy(out + at, ins, n);
+        return at + n + keep;
     }
 
     // ---- Notification rendering ----
 
     void renderNotification() {
-        display.setFullWindow();
-        display.fillScreen(GxEPD_WHITE);
-        display.setTextColor(GxEPD_BLACK);
+        cfPanelFace = -1; // panel no longer shows a face frame
+        cfFrame.fillScreen(GxEPD_WHITE);
+        cfFrame.setTextColor(GxEPD_BLACK);
 
         // Rounded rect border: 10px margin, 2px width, 8px radius
-        display.drawRoundRect(10, 10, 180, 180, 8, GxEPD_BLACK);
-        display.drawRoundRect(11, 11, 178, 178, 7, GxEPD_BLACK);
-
-        int16_t tx, ty;
-        uint16_t tw, th;
+        cfFrame.drawRoundRect(10, 10, 180, 180, 8, GxEPD_BLACK);
+        cfFrame.drawRoundRect(11, 11, 178, 178, 7, GxEPD_BLACK);
 
         // Context-aware header centered near top
-        display.setFont(&FreeSans9pt7b);
+        cfFrame.setFont(&FreeSans9pt7b);
         char headerBuf[24];
         if (cfNotifPreAlert) {
             snprintf(headerBuf, sizeof(headerBuf), "In about %d minutes", cfNotifPreMin);
@@ -426,25 +1278,23 @@ private:
             strcpy(headerBuf, "Now");
         }
         const char* header = headerBuf;
-        display.getTextBounds(header, 0, 0, &tx, &ty, &tw, &th);
-        display.setCursor((200 - (int)tw) / 2, 40);
-        display.print(header);
+        cfFrame.setCursor((200 - measureText(&FreeSans9pt7b, header)) / 2, 40);
+        cfFrame.print(header);
 
         // Horizontal separator line
-        display.drawLine(20, 50, 180, 50, GxEPD_BLACK);
+        cfFrame.drawLine(20, 50, 180, 50, GxEPD_BLACK);
 
         // Event text centered in middle area (word-wrapped to fit)
         const GFXfont* bodyFont = &FreeSans12pt7b;
         char wrapped[120];
         wordWrap(cfNotifText, wrapped, sizeof(wrapped), 128, bodyFont);
-        drawAligned(wrapped, 20, 60, 160, 100, "center", bodyFont, GxEPD_BLACK);
+        drawAligned(wrapped, 20, 60, 160, 100, CF_ALIGN_CENTER, bodyFont, GxEPD_BLACK);
 
         // "Press any button" hint near bottom
-        display.setFont(&FreeSans9pt7b);
+        cfFrame.setFont(&FreeSans9pt7b);
         const char* hint = "Press any button";
-        display.getTextBounds(hint, 0, 0, &tx, &ty, &tw, &th);
-        display.setCursor((200 - (int)tw) / 2, 170);
-        display.print(hint);
+        cfFrame.setCursor((200 - measureText(&FreeSans9pt7b, hint)) / 2, 170);
+        cfFrame.print(hint);
     }
 
     // Buzz until any button is pressed or timeout. Does NOT dismiss the
@@ -488,7 +1338,7 @@ private:
         File f = SPIFFS.open("/wifi.json", FILE_READ);
         if (!f) return 0;
 
-        StaticJsonDocument<1024> doc;
+        CfJsonDoc doc;
         DeserializationError err = deserializeJson(doc, f);
         f.close();
         if (err) return 0;
@@ -514,6 +1364,8 @@ private:
     // ---- Server sync ----
 
     void syncProgress(int percent) {
+        cfPanelFace = -1; // panel no longer shows a face frame
+        cfPanelBar = true; // the frame above the bar is still cfPanelFrame
         // Thin progress bar at the very bottom — partial window update only
         const int barY = 196;
         const int barH = 4;
@@ -721,9 +1573,9 @@ private:
     }
 
     void syncFromServer(bool debug = false) {
-        // Ensure SPIFFS is mounted (handleButtonPress may call us
-        // before drawWatchFace which normally mounts it)
-        SPIFFS.begin(true);
+        // Ensure SPIFFS is mounted (minute ticks and button presses
+        // usually haven't needed it yet)
+        cfMountFS();
 
         String dbg; // debug log, displayed when debug=true
         unsigned long t0 = millis();
@@ -768,9 +1620,12 @@ private:
         client.setInsecure();
 
         HTTPClient http;
-        char url[128];
-        snprintf(url, sizeof(url), "%s%s?watch_id=%s",
-                 CRISPFACE_SERVER, CRISPFACE_API_PATH, CRISPFACE_WATCH_ID);
+        char url[192];
+        int urlLen = snprintf(url, sizeof(url), "%s%s?watch_id=%s",
+                              CRISPFACE_SERVER, CRISPFACE_API_PATH, CRISPFACE_WATCH_ID);
+        if (cfSyncLayout[0] && cfFaceCount > 0 && urlLen > 0 && urlLen < (int)sizeof(url)) {
+            snprintf(url + urlLen, sizeof(url) - urlLen, "&layout=%s", cfSyncLayout);
+        }
 
         http.begin(client, url);
         char authHeader[80];
@@ -780,9 +1635,52 @@ private:
         http.setTimeout(CRISPFACE_HTTP_TIMEOUT);
         http.setConnectTimeout(CRISPFACE_HTTP_TIMEOUT);
         http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
+        if (cfSyncEtag[0] && cfFaceCount > 0) http.addHeader("If-None-Match", cfSyncEtag);
+        // Radio time follows bytes received: take the body compressed
+        http.addHeader("Accept-Encoding", "deflate");
+        const char* keepHeaders[] = { "ETag", "Content-Encoding" };
+        http.collectHeaders(keepHeaders, 2);
+
+        // HTTP/1.0 so the body arrives unchunked and can be parsed
+        // straight off the socket
+        http.useHTTP10(true);
 
         int httpCode = http.GET();
         tHttp = millis();
+        if (httpCode == HTTP_CODE_NOT_MODIFIED && cfSyncEtag[0]) {
+            // Faces, interval and alerts on the watch are still current:
+            // nothing to download, parse or write
+            http.end();
+            cfSyncNTP();
+            WiFi.disconnect(true);
+            WiFi.mode(WIFI_OFF);
+            cfLastSync  = (int)makeTime(currentTime);
+            cfSyncFails = 0;
+            if (debug) {
+                dbg += "\f";
+                dbg += "URL: ";
+                dbg += url;
+                dbg += "\n";
+                dbg += "HTTP: 304 Not Modified\n";
+                dbg += "Faces: ";
+                dbg += String(cfFaceCount);
+                dbg += " Sync: ";
+                dbg += String(cfSyncInterval);
+                dbg += "s\n";
+                dbg += "WiFi: ";
+                dbg += String(tWifi - t0);
+                dbg += "ms\n";
+                dbg += "HTTP: ";
+                dbg += String(tHttp - tWifi);
+                dbg += "ms\n";
+                dbg += "Total: ";
+                dbg += String(millis() - t0);
+                dbg += "ms\n";
+                renderDebug(dbg);
+            }
+            syncProgress(100);
+            return;
+        }
         if (httpCode != 200) {
             http.end();
             cfSyncNTP();
@@ -811,178 +1709,265 @@ private:
 
         syncProgress(40);
 
-        // Get payload, sync time, then kill WiFi
-        String payload = http.getString();
-        http.end();
+        // Set the clock first: alert offsets in the body count from now.
+        // The body is then parsed as it arrives (see CfJsonStream), so WiFi
+        // stays up until the last face is on flash.
+        String etag = http.header("ETag");
+        int bodyLen = http.getSize(); // -1 when the server sends no length
         cfSyncNTP();
-        WiFi.disconnect(true);
-        WiFi.mode(WIFI_OFF);
+        int syncTime = (int)makeTime(currentTime);
+        CfJsonStream js(http.getStream());
+        if (http.header("Content-Encoding") == "deflate") js.inflate();
 
         syncProgress(50);
 
         int wifiApiCount = 0;
         bool wifiWriteOk = false;
-        {
-            DynamicJsonDocument doc(16384);
-            DeserializationError err = deserializeJson(doc, payload);
-            int payloadLen = payload.length();
-            payload = "";
-
-            if (err || !doc["success"].as<bool>()) {
-                cfSyncFails++;
-                if (debug) {
-                    dbg += "HTTP: 200 OK\n";
-                    dbg += "Body: ";
-                    dbg += String(payloadLen);
-                    dbg += " bytes\n";
-                    if (err) {
-                        dbg += "JSON: ";
-                        dbg += err.c_str();
-                        dbg += "\n";
-                    } else {
-                        dbg += "API: success=false\n";
+        int facesWritten = 0;
+        bool success = false;
+        bool delta = false;
+        DeserializationError err = DeserializationError::Ok;
+        bool mismatch = false; // delta: a record didn't match its values
+        char layout[sizeof(cfSyncLayout)] = "";
+        int count = 0;
+        int minServerStale = 86400;
+        bool anyServerComp = false;
+
+        // Only files whose content differs from the manifest are written
+        CfSyncManifest man;
+        bool manOk = readManifest(man);
+        bool hadManifest = manOk;
+        bool manDirty = false;
+        // Drop the manifest before the first write (see CfSyncManifest)
+        auto beginWrite = [&]() {
+            if (manOk) SPIFFS.remove("/sync.man");
+            manOk = false;
+            manDirty = true;
+        };
+
+        // Writes a compiled face's record and static layer unless the
+        // manifest says its files already hold it
+        auto writeFace = [&](int index, int recLen) {
+            uint32_t fileHash = cfFaceFileHash(cfFaceBuf, recLen);
+            bool known = index < (int)man.faceCount;
+            if (known && man.face[index] == fileHash) return;
+            beginWrite();
+            char path[24];
+            snprintf(path, sizeof(path), "/face_%d.bin", index);
+            bool ok = false;
+            File out = SPIFFS.open(path, FILE_WRITE);
+            if (out) {
+                ok = out.write(cfFaceBuf, recLen) == (size_t)recLen;
+                out.close();
+            }
+            ok = saveLayer(index, cfFaceBuf) && ok;
+            man.face[index] = ok ? fileHash : 0;
+            facesWritten++;
+        };
+
+        // Walk the response object member by member. A full response has
+        // faces and wifi, a delta has values (sorted by face) and alerts.
+        int members = 0;
+        int cur = -1, recLen = 0; // delta: face being patched
+        bool alertsNew = false;
+        if (js.expect('{')) {
+            while (js.item('}', members)) {
+                char key[12];
+                if (!js.readKey(key, sizeof(key))) break;
+                if (!strcmp(key, "success") || !strcmp(key, "delta")) {
+                    char atom[8];
+                    if (!js.readAtom(atom, sizeof(atom))) break;
+                    bool on = !strcmp(atom, "true");
+                    if (key[0] == 'd') {
+                        delta = on;
+                        continue;
+                    }
+                    success = on;
+                    if (!success) break;
+                    // Files are about to change: until the body is all
+                    // in, no ETag or layout version describes them
+                    cfSyncEtag[0] = '\0';
+                    cfSyncLayout[0] = '\0';
+                } else if (!strcmp(key, "layout")) {
+                    js.readString(layout, sizeof(layout));
+                } else if (!success) {
+                    // success leads every response; nothing is used without it
+                    break;
+                } else if (!strcmp(key, "wifi")) {
+                    // Save WiFi networks to SPIFFS (allows OTA WiFi updates)
+                    CfJsonDoc doc;
+                    err = deserializeJson(doc, js);
+                    if (err) break;
+                    JsonArray wifiArr = doc.as<JsonArray>();
+                    wifiApiCount = wifiArr.isNull() ? 0 : (int)wifiArr.size();
+                    if (!wifiArr.isNull()) {
+                        CfHashPrint hp;
+                        serializeJson(wifiArr, hp);
+                        wifiWriteOk = hp.h == man.wifi;
+                        if (!wifiWriteOk) {
+                            beginWrite();
+                            man.wifi = 0;
+                            File wf = SPIFFS.open("/wifi.json", FILE_WRITE);
+                            if (wf) { serializeJson(wifiArr, wf); wf.close(); wifiWriteOk = true; man.wifi = hp.h; }
+                        }
+                    }
+                } else if (!strcmp(key, "faces") || !strcmp(key, "values") || !strcmp(key, "alerts")) {
+                    if (!js.expect('[')) break;
+                    int n = 0;
+                    while (js.item(']', n)) {
+                        // The watch keeps CF_MAX_FACES faces, as many as
+                        // the manifest describes; the rest go unparsed
+                        if (key[0] == 'f' && count >= CF_MAX_FACES) {
+                            if (!js.skipValue()) break;
+                            continue;
+                        }
+                        CfJsonDoc doc;
+                        err = deserializeJson(doc, js);
+                        if (err) break;
+                        // The old alerts go once the new ones start arriving
+                        if (key[0] != 'v' && !alertsNew) {
+                            cfAlertCount = 0;
+                            alertsNew = true;
+                        }
+                        if (key[0] == 'f') {
+                            JsonObject face = doc.as<JsonObject>();
+                            writeFace(count, compileFace(face, cfFaceBuf, sizeof(cfFaceBuf)));
+
+                            // Check face-level stale — if -1, skip complication stale checks
+                            int faceStale = face["stale"] | 60;
+                            for (JsonObject comp : face["complications"].as<JsonArray>()) {
+                                if (faceStale > 0 && !(comp["local"] | false)) {
+                                    int s = comp["stale"] | 600;
+                                    if (s > 0) {
+                                        anyServerComp = true;
+                                        if (s < minServerStale) minServerStale = s;
+                                    }
+                                }
+                                addAlerts(comp["alerts"].as<JsonArray>(), syncTime);
+                            }
+
+                            count++;
+                            if (bodyLen > 0) syncProgress(50 + (int)(40 * js.wire / bodyLen));
+                        } else if (key[0] == 'v') {
+                            // Same layout as the faces on flash: patch the
+                            // values that changed into their records
+                            JsonArray v = doc.as<JsonArray>();
+                            int fi = v[0] | -1;
+                            if (fi != cur) {
+                                if (cur >= 0) writeFace(cur, recLen);
+                                cur = fi;
+                                recLen = fi >= 0 && fi < cfFaceCount ? readFaceFile(fi) : 0;
+                            }
+                            if (recLen > 0) recLen = patchFaceValue(cfFaceBuf, sizeof(cfFaceBuf), v[1] | -1, v[2] | "");
+                            if (recLen == 0) {
+                                mismatch = true;
+                                break;
+                            }
+                        } else {
+                            addAlert(doc.as<JsonObject>(), syncTime);
+                        }
                     }
-                    dbg += "Fails: ";
-                    dbg += String(cfSyncFails);
-                    dbg += " Backoff: ";
-                    dbg += String(cfBackoffSeconds());
-                    dbg += "s\n";
-                    renderDebug(dbg);
+                    if (key[0] == 'v' && cur >= 0 && recLen > 0) {
+                        writeFace(cur, recLen);
+                        cur = -1;
+                    }
+                    if (err || mismatch) break;
+                } else {
+                    js.skipValue();
                 }
-                syncProgress(0);
-                return;
             }
+        }
+        bool bodyOk = success && !js.bad && !err && !mismatch && (delta || count > 0);
+        tParse = millis();
 
-            // Save WiFi networks to SPIFFS (allows OTA WiFi updates)
-            JsonArray wifiArr = doc["wifi"].as<JsonArray>();
-            wifiApiCount = wifiArr.isNull() ? 0 : (int)wifiArr.size();
-            wifiWriteOk = false;
-            if (!wifiArr.isNull()) {
-                File wf = SPIFFS.open("/wifi.json", FILE_WRITE);
-                if (wf) { serializeJson(wifiArr, wf); wf.close(); wifiWriteOk = true; }
-            }
+        http.end();
+        WiFi.disconnect(true);
+        WiFi.mode(WIFI_OFF);
 
-            JsonArray faces = doc["faces"].as<JsonArray>();
-            int total = faces.size();
-            if (total == 0) {
-                cfSyncFails++;
-                if (debug) {
-                    dbg += "HTTP: 200 OK\n";
+        if (!bodyOk) {
+            // Faces already written stay, and the manifest records them.
+            // No ETag or layout is held now, so the next sync is a full one.
+            cfSyncFails++;
+            if (manDirty) {
+                if (count > (int)man.faceCount) man.faceCount = count;
+                writeManifest(man);
+            }
+            if (facesWritten > 0) cfFaceGen++;
+            if (debug) {
+                dbg += "HTTP: 200 OK\n";
+                dbg += "Body: ";
+                dbg += String((unsigned long)js.wire);
+                dbg += " bytes\n";
+                if (mismatch) {
+                    dbg += "Delta: face ";
+                    dbg += String(cur);
+                    dbg += " mismatch\n";
+                } else if (err || js.bad) {
+                    dbg += "JSON: ";
+                    dbg += err ? err.c_str() : "InvalidInput";
+                    dbg += "\n";
+                } else if (!success) {
+                    dbg += "API: success=false\n";
+                } else {
                     dbg += "Faces: 0 (empty)\n";
-                    dbg += "Fails: ";
-                    dbg += String(cfSyncFails);
-                    dbg += " Backoff: ";
-                    dbg += String(cfBackoffSeconds());
-                    dbg += "s\n";
-                    renderDebug(dbg);
                 }
-                syncProgress(0);
-                return;
-            }
-
-            syncProgress(60);
-
-            // Delete stale face files beyond new count (0..total-1 get overwritten)
-            for (int i = total; i < 10; i++) {
-                char path[24];
-                snprintf(path, sizeof(path), "/face_%d.json", i);
-                if (!SPIFFS.exists(path)) break; // no more old files
-                SPIFFS.remove(path);
+                dbg += "Fails: ";
+                dbg += String(cfSyncFails);
+                dbg += " Backoff: ";
+                dbg += String(cfBackoffSeconds());
+                dbg += "s\n";
+                renderDebug(dbg);
             }
+            syncProgress(0);
+            return;
+        }
 
-            int count = 0;
-            int minServerStale = 86400;
-            bool anyServerComp = false;
-
-            for (JsonObject face : faces) {
+        if (delta) {
+            count = cfFaceCount;
+        } else {
+            // Delete stale face files beyond new count (0..count-1 were
+            // overwritten if changed). Without a manifest, also sweep for
+            // JSON faces cached by firmware before the compiled format.
+            bool sweep = !hadManifest;
+            int oldCount = sweep ? CF_MAX_FACES : (int)man.faceCount;
+            if (oldCount > count) beginWrite();
+            if (oldCount != count) manDirty = true;
+            for (int i = sweep ? 0 : count; i < oldCount; i++) {
                 char path[24];
-                snprintf(path, sizeof(path), "/face_%d.json", count);
-
-                File out = SPIFFS.open(path, FILE_WRITE);
-                if (out) {
-                    serializeJson(face, out);
-                    out.close();
-                }
-
-                // Check face-level stale — if -1, skip complication stale checks
-                int faceStale = face["stale"] | 60;
-                if (faceStale > 0) {
-                    for (JsonObject comp : face["complications"].as<JsonArray>()) {
-                        if (!(comp["local"] | false)) {
-                            int s = comp["stale"] | 600;
-                            if (s > 0) {
-                                anyServerComp = true;
-                                if (s < minServerStale) minServerStale = s;
-                            }
-                        }
-                    }
+                if (sweep) {
+                    snprintf(path, sizeof(path), "/face_%d.json", i);
+                    if (SPIFFS.exists(path)) SPIFFS.remove(path);
+                    if (i < count) continue;
                 }
-
-                count++;
-                syncProgress(60 + (30 * count / total));
+                snprintf(path, sizeof(path), "/face_%d.bin", i);
+                if (SPIFFS.exists(path)) SPIFFS.remove(path);
+                snprintf(path, sizeof(path), "/face_%d.img", i);
+                if (SPIFFS.exists(path)) SPIFFS.remove(path);
             }
+        }
 
-            tParse = millis();
-
-            cfFaceCount    = count;
-            // If no server complications need refreshing, sync once a day
-            // (user can always manual-sync via top-left button)
+        if (manDirty) {
+            for (int i = count; i < CF_MAX_FACES; i++) man.face[i] = 0;
+            man.faceCount = count;
+            writeManifest(man);
+        }
+        // Faces rewritten — invalidate the RTC face cache and panel state
+        if (facesWritten > 0 || count != cfFaceCount) cfFaceGen++;
+        cfFaceCount    = count;
+        // If no server complications need refreshing, sync once a day
+        // (user can always manual-sync via top-left button). A delta
+        // keeps the layout, so the interval computed from it stands.
+        if (!delta) {
             cfSyncInterval = anyServerComp ? (minServerStale > 60 ? minServerStale : 60) : 86400;
-            cfLastSync     = (int)makeTime(currentTime);
-            cfSyncFails    = 0; // reset backoff on success
-
-            // Collect alerts from all faces — two per event (pre-alert + event-time)
-            cfAlertCount = 0;
-            int syncTime = cfLastSync;
-            for (JsonObject face : faces) {
-                for (JsonObject comp : face["complications"].as<JsonArray>()) {
-                    JsonArray alerts = comp["alerts"].as<JsonArray>();
-                    if (alerts.isNull()) continue;
-                    for (JsonObject alert : alerts) {
-                        int secFromNow = alert["sec"] | 0;
-                        if (secFromNow <= 0) continue;
-
-                        int evTime = syncTime + secFromNow;
-                        bool ins = alert["ins"] | false;
-                        const char* txt = alert["text"] | "Event";
-                        const char* evTimeStr = alert["time"] | "";
-                        int preSec = alert["pre"] | 300; // default 300s for backwards compat
-
-                        // 1. Pre-alert (configurable minutes before event)
-                        if (cfAlertCount < 20) {
-                            cfAlerts[cfAlertCount].eventTime = evTime - preSec;
-                            cfAlerts[cfAlertCount].buzzCount = ins ? 0 : 1;
-                            cfAlerts[cfAlertCount].fired = false;
-                            cfAlerts[cfAlertCount].preAlert = true;
-                            cfAlerts[cfAlertCount].preMin = preSec / 60;
-                            strncpy(cfAlerts[cfAlertCount].text, txt, 59);
-                            cfAlerts[cfAlertCount].text[59] = '\0';
-                            strncpy(cfAlerts[cfAlertCount].time, evTimeStr, 5);
-                            cfAlerts[cfAlertCount].time[5] = '\0';
-                            cfAlertCount++;
-                        }
-
-                        // 2. Event-time alert
-                        if (cfAlertCount < 20) {
-                            cfAlerts[cfAlertCount].eventTime = evTime;
-                            cfAlerts[cfAlertCount].buzzCount = ins ? 0 : 3;
-                            cfAlerts[cfAlertCount].fired = false;
-                            cfAlerts[cfAlertCount].preAlert = false;
-                            cfAlerts[cfAlertCount].preMin = 0;
-                            strncpy(cfAlerts[cfAlertCount].text, txt, 59);
-                            cfAlerts[cfAlertCount].text[59] = '\0';
-                            strncpy(cfAlerts[cfAlertCount].time, evTimeStr, 5);
-                            cfAlerts[cfAlertCount].time[5] = '\0';
-                            cfAlertCount++;
-                        }
+        }
+        cfLastSync     = syncTime;
+        cfSyncFails    = 0; // reset backoff on success
+        if (!alertsNew) cfAlertCount = 0;
 
-                        if (cfAlertCount >= 20) break;
-                    }
-                    if (cfAlertCount >= 20) break;
-                }
-                if (cfAlertCount >= 20) break;
-            }
+        if (etag.length() < sizeof(cfSyncEtag)) {
+            memcpy(cfSyncEtag, etag.c_str(), etag.length() + 1);
         }
+        strncpy(cfSyncLayout, layout, sizeof(cfSyncLayout));
 
         if (debug) {
             unsigned long tTotal = millis();
@@ -1003,6 +1988,18 @@ private:
             dbg += " Sync: ";
             dbg += String(cfSyncInterval);
             dbg += "s\n";
+            dbg += "Written: ";
+            dbg += String(facesWritten);
+            dbg += " faces\n";
+            dbg += "Body: ";
+            dbg += String((unsigned long)js.wire);
+            if (js.inflating()) {
+                dbg += " deflate, ";
+                dbg += String((unsigned long)js.bytes);
+                dbg += " JSON\n";
+            } else {
+                dbg += " bytes\n";
+            }
             dbg += "WiFi: ";
             dbg += String(tWifi - t0);
             dbg += "ms\n";
@@ -1012,6 +2009,11 @@ private:
             dbg += "Parse: ";
             dbg += String(tParse - tHttp);
             dbg += "ms\n";
+            dbg += "JSON peak: ";
+            dbg += String(cfJsonPeak);
+            dbg += "/";
+            dbg += String(CRISPFACE_JSON_ARENA);
+            dbg += "\n";
             dbg += "Total: ";
             dbg += String(tTotal - t0);
             dbg += "ms\n";
@@ -1021,15 +2023,63 @@ private:
         syncProgress(100);
     }
 
+    // Schedules every event of one alerts array of a sync response
+    void addAlerts(JsonArray alerts, int syncTime) {
+        if (alerts.isNull()) return;
+        for (JsonObject alert : alerts) addAlert(alert, syncTime);
+    }
+
+    // Schedules two alerts for one event (pre-alert + event-time), up to
+    // the 20 cfAlerts slots
+    void addAlert(JsonObject alert, int syncTime) {
+        if (cfAlertCount >= 20) return;
+        int secFromNow = alert["sec"] | 0;
+        if (secFromNow <= 0) return;
+
+        int evTime = syncTime + secFromNow;
+        bool ins = alert["ins"] | false;
+        const char* txt = alert["text"] | "Event";
+        const char* evTimeStr = alert["time"] | "";
+        int preSec = alert["pre"] | 300; // default 300s for backwards compat
+
+        // 1. Pre-alert (configurable minutes before event)
+        if (cfAlertCount < 20) {
+            cfAlerts[cfAlertCount].eventTime = evTime - preSec;
+            cfAlerts[cfAlertCount].buzzCount = ins ? 0 : 1;
+            cfAlerts[cfAlertCount].fired = false;
+            cfAlerts[cfAlertCount].preAlert = true;
+            cfAlerts[cfAlertCount].preMin = preSec / 60;
+            strncpy(cfAlerts[cfAlertCount].text, txt, 59);
+            cfAlerts[cfAlertCount].text[59] = '\0';
+            strncpy(cfAlerts[cfAlertCount].time, evTimeStr, 5);
+            cfAlerts[cfAlertCount].time[5] = '\0';
+            cfAlertCount++;
+        }
+
+        // 2. Event-time alert
+        if (cfAlertCount < 20) {
+            cfAlerts[cfAlertCount].eventTime = evTime;
+            cfAlerts[cfAlertCount].buzzCount = ins ? 0 : 3;
+            cfAlerts[cfAlertCount].fired = false;
+            cfAlerts[cfAlertCount].preAlert = false;
+            cfAlerts[cfAlertCount].preMin = 0;
+            strncpy(cfAlerts[cfAlertCount].text, txt, 59);
+            cfAlerts[cfAlertCount].text[59] = '\0';
+            strncpy(cfAlerts[cfAlertCount].time, evTimeStr, 5);
+            cfAlerts[cfAlertCount].time[5] = '\0';
+            cfAlertCount++;
+        }
+    }
+
     // ---- Debug display ----
 
     void renderDebug(String &info) {
+        cfPanelFace = -1; // panel no longer shows a face frame
+        cfPanelFrame = 0;
         display.setFont(&FreeSans9pt7b);
-        int16_t tx, ty;
-        uint16_t tw, th;
-        display.getTextBounds("Ay", 0, 0, &tx, &ty, &tw, &th);
-        int ascent = -(int)ty;
-        int lineH = (int)th + 3;
+        GFXMetrics fm = fontMetrics(&FreeSans9pt7b);
+        int ascent = fm.ascent;
+        int lineH = fm.ascent + fm.descent + 3;
         int linesPerPage = (194 - (ascent + 2)) / lineH;
 
         // Split into explicit pages on '\f', then lines on '\n'
@@ -1126,136 +2176,581 @@ private:
         }
     }
 
-    // ---- Render face from SPIFFS ----
+    // ---- Compile face JSON to binary record ----
+
+    // Appends a NUL-terminated string to the pool, truncating it if the
+    // record is full. Returns its offset (an empty string when out of space).
+    uint16_t poolAdd(uint8_t* buf, int cap, int& used, const char* str) {
+        int avail = cap - used - 1;
+        if (avail < 0) return (uint16_t)(cap - 1); // final byte is always NUL
+        int n = strlen(str);
+        if (n > avail) n = avail;
+        uint16_t off = (uint16_t)used;
+        memcpy(buf + used, str, n);
+        buf[used + n] = '\0';
+        used += n + 1;
+        return off;
+    }
 
-    void renderFace(const char* path) {
-        display.setFullWindow();
+    static uint8_t clampU8(int v) { return v < 0 ? 0 : (v > 255 ? 255 : (uint8_t)v); }
+
+    // A server complication's kind follows its value: "icon:CODE" or
+    // "icon:CODE:SIZE" is a weather icon, anything else text
+    static void setServerKind(CfCompRec& r, const char* val) {
+        if (strncmp(val, "icon:", 5) == 0) {
+            const char* sizeStr = strchr(val + 5, ':');
+            r.kind   = CF_KIND_ICON;
+            r.param  = clampU8(atoi(val + 5));
+            r.param2 = clampU8(sizeStr ? atoi(sizeStr + 1) : 0);
+        } else {
+            r.kind   = CF_KIND_TEXT;
+            r.param  = 0;
+            r.param2 = 0;
+        }
+    }
+
+    // Replaces server complication `ci`'s value in the record in `buf` as
+    // compileFace() would have stored it: the pool is rebuilt in record
+    // order in cfPatchBuf and the layer flags reclassified. Returns the new
+    // record length, or 0 if `ci` is not a server complication. A value for
+    // a complication past CF_MAX_COMPS, which compileFace() dropped, leaves
+    // the record as it is.
+    int patchFaceValue(uint8_t* buf, int cap, int ci, const char* val) {
+        const CfFaceHeader* hdr = (const CfFaceHeader*)buf;
+        const CfCompRec* recs = (const CfCompRec*)(buf + sizeof(CfFaceHeader));
+        int n = hdr->compCount;
+        if (ci >= CF_MAX_COMPS && n == CF_MAX_COMPS) return hdr->size;
+        if (ci < 0 || ci >= n || (recs[ci].flags & CF_COMP_LOCAL)) return 0;
+        if (cap > (int)sizeof(cfPatchBuf)) cap = sizeof(cfPatchBuf);
+
+        memset(cfPatchBuf, 0, cap);
+        int used = sizeof(CfFaceHeader) + n * sizeof(CfCompRec);
+        memcpy(cfPatchBuf, buf, used);
+        CfCompRec* out = (CfCompRec*)(cfPatchBuf + sizeof(CfFaceHeader));
+        cfPatchBuf[used++] = '\0';
+        for (int i = 0; i < n; i++) {
+            CfCompRec& r = out[i];
+            const char* str = (const char*)buf + recs[i].value;
+            if (i == ci) {
+                setServerKind(r, val);
+                r.vol = compVolatility(r);
+                str = r.kind == CF_KIND_TEXT ? val : "";
+            }
+            r.value = poolAdd(cfPatchBuf, cap, used, str);
+            r.flags &= ~(CF_COMP_DYNAMIC | CF_COMP_UNDER);
+        }
+        classifyLayer(out, n);
+
+        if (used > cap) used = cap;
+        ((CfFaceHeader*)cfPatchBuf)->size = (uint16_t)used;
+        memcpy(buf, cfPatchBuf, used);
+        return used;
+    }
+
+    // Returns the record length (always a valid record, possibly empty).
+    // Complications beyond CF_MAX_COMPS are dropped and over-long values
+    // truncated, so a big face degrades instead of failing to render.
+    int compileFace(JsonObject face, uint8_t* buf, int cap) {
+        memset(buf, 0, cap);
+        CfFaceHeader* hdr = (CfFaceHeader*)buf;
+        CfCompRec* recs = (CfCompRec*)(buf + sizeof(CfFaceHeader));
+
+        const char* bg = face["bg"] | "white";
+        hdr->magic   = CF_FACE_MAGIC;
+        hdr->version = CF_FACE_VERSION;
+        hdr->bg      = strcmp(bg, "black") == 0 ? CF_COLOR_BLACK : CF_COLOR_WHITE;
+
+        JsonArray comps = face["complications"].as<JsonArray>();
+        int n = comps.isNull() ? 0 : (int)comps.size();
+        if (n > CF_MAX_COMPS) n = CF_MAX_COMPS;
+        int used = sizeof(CfFaceHeader) + n * sizeof(CfCompRec);
+        buf[used++] = '\0'; // pool always holds at least an empty string
+
+        int i = 0;
+        for (JsonObject comp : comps) {
+            if (i >= n) break;
+            CfCompRec& r = recs[i++];
+
+            const char* typ = comp["type"] | "";
+            const char* cid = comp["id"] | "";
+            const char* effType = strlen(typ) > 0 ? typ : cid;
+            const char* al  = comp["align"] | "left";
+            const char* col = comp["color"] | "black";
+            const char* val = comp["value"] | "";
+            bool isLocal    = comp["local"] | false;
+
+            r.stale  = comp["stale"] | 60;
+            r.x      = comp["x"] | 0;
+            r.y      = comp["y"] | 0;
+            r.w      = comp["w"] | 0;
+            r.h      = comp["h"] | 0;
+            r.family = fontFamilyId(comp["font"] | "sans");
+            r.size   = clampU8(comp["size"] | 16);
+            r.align  = strcmp(al, "center") == 0 ? CF_ALIGN_CENTER
+                     : strcmp(al, "right") == 0 ? CF_ALIGN_RIGHT : CF_ALIGN_LEFT;
+            r.bw     = clampU8(comp["bw"] | 0);
+            r.br     = clampU8(comp["br"] | 0);
+            r.bp     = clampU8(comp["bp"] | 0);
+            r.pt     = clampU8(comp["pt"] | 0);
+            r.pl     = clampU8(comp["pl"] | 0);
+            if (comp["bold"] | false)          r.flags |= CF_COMP_BOLD;
+            if (strcmp(col, "white") == 0)     r.flags |= CF_COMP_WHITE;
+            if (isLocal)                       r.flags |= CF_COMP_LOCAL;
+
+            if (isLocal) {
+                if (strcmp(effType, "time") == 0) {
+                    const char* layout = comp["params"]["layout"] | "horizontal";
+                    r.kind  = CF_KIND_TIME;
+                    r.param = strcmp(layout, "vertical") == 0 ? 1 : 0;
+                } else if (strcmp(effType, "date") == 0) {
+                    r.kind = CF_KIND_DATE;
+                } else if (strcmp(effType, "version") == 0) {
+                    r.kind = CF_KIND_VERSION;
+                } else if (strcmp(effType, "battery") == 0) {
+                    const char* mode = comp["params"]["display"] | "icon";
+                    r.kind  = CF_KIND_BATTERY;
+                    r.param = strcmp(mode, "icon") == 0 ? CF_BAT_ICON
+                            : strcmp(mode, "percentage") == 0 ? CF_BAT_PERCENT
+                            : CF_BAT_VOLTAGE;
+                } else {
+                    r.kind = CF_KIND_LOCAL;
+                    val = effType;
+                }
+            } else {
+                setServerKind(r, val);
+            }
+
+            r.value = poolAdd(buf, cap, used, r.kind == CF_KIND_TEXT || r.kind == CF_KIND_LOCAL ? val : "");
+            r.vol   = compVolatility(r);
+        }
+
+        classifyLayer(recs, n);
+
+        if (used > cap) used = cap;
+        hdr->compCount = (uint8_t)n;
+        hdr->size      = (uint16_t)used;
+        return used;
+    }
+
+    // What can change a complication's pixels between syncs
+    static uint8_t compVolatility(const CfCompRec& r) {
+        if (r.kind == CF_KIND_TIME)    return CF_VOL_MINUTE;
+        if (r.kind == CF_KIND_DATE)    return CF_VOL_DAY;
+        if (r.kind == CF_KIND_BATTERY) return CF_VOL_BATTERY;
+        if (r.kind == CF_KIND_TEXT && r.stale > 0) return CF_VOL_STALE;
+        return CF_VOL_SYNC;
+    }
+
+    static bool boxesOverlap(const CfCompRec& a, const CfCompRec& b) {
+        return a.x < b.x + b.w && b.x < a.x + a.w
+            && a.y < b.y + b.h && b.y < a.y + a.h;
+    }
+
+    // Splits a face into the static layer and the per-tick complications.
+    // A static complication overlapping an earlier per-tick one must still
+    // be drawn above it, so it becomes per-tick too; drawing the per-tick
+    // set over the layer then gives the same frame as drawing in order.
+    // Static complications inside the per-tick region, widened to whole
+    // bytes as window pushes are, are marked UNDER so window-only ticks can
+    // redraw what lies beneath the changed boxes.
+    static void classifyLayer(CfCompRec* recs, int n) {
+        int x0 = 200, y0 = 200, x1 = 0, y1 = 0;
+        for (int i = 0; i < n; i++) {
+            CfCompRec& r = recs[i];
+            bool dynamic = r.vol != CF_VOL_SYNC;
+            for (int j = 0; j < i && !dynamic; j++) {
+                dynamic = (recs[j].flags & CF_COMP_DYNAMIC) && boxesOverlap(r, recs[j]);
+            }
+            if (!dynamic) continue;
+            r.flags |= CF_COMP_DYNAMIC;
+            if (r.x < x0) x0 = r.x;
+            if (r.y < y0) y0 = r.y;
+            if (r.x + r.w > x1) x1 = r.x + r.w;
+            if (r.y + r.h > y1) y1 = r.y + r.h;
+        }
+        x0 &= ~7;
+        x1 = (x1 + 7) & ~7;
+        for (int i = 0; i < n; i++) {
+            CfCompRec& r = recs[i];
+            if (r.flags & CF_COMP_DYNAMIC) continue;
+            if (r.x < x1 && x0 < r.x + r.w && r.y < y1 && y0 < r.y + r.h) {
+                r.flags |= CF_COMP_UNDER;
+            }
+        }
+    }
+
+    // Structural check before the renderer trusts a record read from flash
+    bool faceRecordValid(const uint8_t* buf, int len) {
+        if (len < (int)sizeof(CfFaceHeader)) return false;
+        const CfFaceHeader* hdr = (const CfFaceHeader*)buf;
+        if (hdr->magic != CF_FACE_MAGIC || hdr->version != CF_FACE_VERSION) return false;
+        if (hdr->size != len || hdr->compCount > CF_MAX_COMPS) return false;
+        int poolStart = sizeof(CfFaceHeader) + hdr->compCount * sizeof(CfCompRec);
+        if (poolStart >= len || buf[len - 1] != '\0') return false;
+        const CfCompRec* recs = (const CfCompRec*)(buf + sizeof(CfFaceHeader));
+        for (int i = 0; i < hdr->compCount; i++) {
+            if (recs[i].value < poolStart || recs[i].value >= len) return false;
+        }
+        return true;
+    }
+
+    // ---- Load active face record ----
+
+    // Reads /face_N.bin into cfFaceBuf. Returns its length, or 0 if it is
+    // missing or invalid.
+    int readFaceFile(int index) {
+        if (!cfMountFS()) return 0;
+        char path[24];
+        snprintf(path, sizeof(path), "/face_%d.bin", index);
         File f = SPIFFS.open(path, FILE_READ);
-        if (!f) { renderFallback(); return; }
+        if (!f) return 0;
+        int len = f.read(cfFaceBuf, sizeof(cfFaceBuf));
+        f.close();
+        return faceRecordValid(cfFaceBuf, len) ? len : 0;
+    }
 
-        DynamicJsonDocument doc(8192);
-        DeserializationError err = deserializeJson(doc, f);
+    // Returns the compiled record for face `index`, from the RTC cache when
+    // it is current, otherwise from SPIFFS (refreshing the cache if it fits).
+    // Returns nullptr if the record is missing or invalid.
+    const uint8_t* loadFace(int index) {
+        if (cfRtcFaceIdx == index && cfRtcFaceGen == cfFaceGen) {
+            int len = ((const CfFaceHeader*)cfRtcFace)->size;
+            if (len <= CF_RTC_FACE_BYTES && faceRecordValid(cfRtcFace, len)) return cfRtcFace;
+        }
+        cfRtcFaceIdx = -1;
+
+        int len = readFaceFile(index);
+        if (len == 0) return nullptr;
+
+        if (len <= CF_RTC_FACE_BYTES) {
+            memcpy(cfRtcFace, cfFaceBuf, len);
+            cfRtcFaceIdx = index;
+            cfRtcFaceGen = cfFaceGen;
+        }
+        return cfFaceBuf;
+    }
+
+    // ---- Static layer ----
+
+    // Renders the static complications of a compiled face into cfFrame and
+    // stores the result as /face_N.img. Called by sync for each face whose
+    // record changed. Returns false if the file could not be written.
+    bool saveLayer(int index, const uint8_t* rec) {
+        const CfFaceHeader* hdr = (const CfFaceHeader*)rec;
+        const CfCompRec* recs = (const CfCompRec*)(rec + sizeof(CfFaceHeader));
+
+        cfFrame.fillScreen(hdr->bg == CF_COLOR_BLACK ? GxEPD_BLACK : GxEPD_WHITE);
+        int now = makeTime(currentTime);
+        for (int i = 0; i < hdr->compCount; i++) {
+            if (recs[i].flags & CF_COMP_DYNAMIC) continue;
+            renderComplication(recs[i], (const char*)rec + recs[i].value, now);
+        }
+
+        char path[24];
+        snprintf(path, sizeof(path), "/face_%d.img", index);
+        File out = SPIFFS.open(path, FILE_WRITE);
+        if (!out) return false;
+        CfLayerHeader lh = { CF_LAYER_MAGIC, cfFaceFileHash(rec, hdr->size) };
+        bool ok = out.write((const uint8_t*)&lh, sizeof(lh)) == sizeof(lh)
+            && out.write(cfFrame.buffer(), CF_LAYER_BYTES) == CF_LAYER_BYTES;
+        out.close();
+        return ok;
+    }
+
+    // Reads face `index`'s static layer into cfFrame. Returns false if it
+    // is missing, short, or was rendered from a different record or firmware.
+    bool loadLayer(int index, const uint8_t* rec) {
+        if (!cfMountFS()) return false;
+        char path[24];
+        snprintf(path, sizeof(path), "/face_%d.img", index);
+        File f = SPIFFS.open(path, FILE_READ);
+        if (!f) return false;
+        CfLayerHeader lh;
+        bool ok = f.read((uint8_t*)&lh, sizeof(lh)) == sizeof(lh)
+            && lh.magic == CF_LAYER_MAGIC
+            && lh.faceHash == cfFaceFileHash(rec, ((const CfFaceHeader*)rec)->size)
+            && f.read(cfFrame.buffer(), CF_LAYER_BYTES) == CF_LAYER_BYTES;
+        f.close();
+        return ok;
+    }
+
+    // What a face's files are written from: its record, and the firmware
+    // that rendered the layer (a reflash may draw it differently)
+    static uint32_t cfFaceFileHash(const uint8_t* rec, int len) {
+        return cfHash(rec, len, cfHash(CRISPFACE_VERSION, sizeof(CRISPFACE_VERSION)));
+    }
+
+    // Reads /sync.man into `man`; zeroed (nothing known) if missing or invalid
+    bool readManifest(CfSyncManifest& man) {
+        memset(&man, 0, sizeof(man));
+        File f = SPIFFS.open("/sync.man", FILE_READ);
+        if (!f) return false;
+        bool ok = f.read((uint8_t*)&man, sizeof(man)) == sizeof(man)
+            && man.magic == CF_MANIFEST_MAGIC;
+        f.close();
+        if (!ok) memset(&man, 0, sizeof(man));
+        return ok;
+    }
+
+    void writeManifest(CfSyncManifest& man) {
+        man.magic = CF_MANIFEST_MAGIC;
+        File f = SPIFFS.open("/sync.man", FILE_WRITE);
+        if (!f) return;
+        f.write((const uint8_t*)&man, sizeof(man));
         f.close();
-        if (err) { renderFallback(); return; }
+    }
 
-        // Background
-        const char* bg = doc["bg"] | "white";
-        display.fillScreen(strcmp(bg, "black") == 0 ? GxEPD_BLACK : GxEPD_WHITE);
+    // Hashes whatever is printed to it, so JSON can be compared with what
+    // is on flash without serialising it into a buffer
+    struct CfHashPrint : public Print {
+        uint32_t h = 2166136261u;
+        size_t write(uint8_t c) override { h ^= c; h *= 16777619u; return 1; }
+        size_t write(const uint8_t* buf, size_t n) override { h = cfHash(buf, n, h); return n; }
+    };
+
+    // ---- Render face ----
+
+    void renderFace(int index) {
+        const uint8_t* rec = loadFace(index);
+        if (!rec) {
+            if (!cfFsMounted) {
+                cfPanelFace = -1;
+                cfFrame.fillScreen(GxEPD_WHITE);
+                cfFrame.setTextColor(GxEPD_BLACK);
+                cfFrame.setFont(NULL);
+                cfFrame.setCursor(10, 100);
+                cfFrame.print("SPIFFS failed");
+                return;
+            }
+            renderFallback();
+            return;
+        }
+
+        const CfFaceHeader* hdr = (const CfFaceHeader*)rec;
+        const CfCompRec* recs = (const CfCompRec*)(rec + sizeof(CfFaceHeader));
 
         int now = makeTime(currentTime);
 
-        // Render each complication
-        for (JsonObject comp : doc["complications"].as<JsonArray>()) {
-            renderComplication(comp, now);
+        // Only diff against the panel if it shows this face's last frame
+        // and this push sends a window rather than the whole frame
+        bool samePanel = cfPushWindow && cfPanelFace == index && cfPanelGen == cfFaceGen
+                         && cfPanelComps == hdr->compCount;
+        cfDirtyX0 = cfDirtyY0 = 200;
+        cfDirtyX1 = cfDirtyY1 = 0;
+
+        // A window-only push needs correct pixels only inside the window,
+        // so it just redraws what overlaps it there
+        if (samePanel) {
+            renderWindow(hdr, recs, rec, now);
+        } else {
+            // A whole frame starts from the static layer, then draws the
+            // rest and remembers what each complication showed
+            bool fromLayer = loadLayer(index, rec);
+            if (!fromLayer) {
+                cfFrame.fillScreen(hdr->bg == CF_COLOR_BLACK ? GxEPD_BLACK : GxEPD_WHITE);
+            }
+            for (int i = 0; i < hdr->compCount; i++) {
+                const CfCompRec& c = recs[i];
+                if (!(c.flags & CF_COMP_DYNAMIC) && fromLayer) continue;
+                cfPanelHash[i] = renderComplication(c, (const char*)rec + c.value, now);
+                cfPanelKey[i]  = volKey(c, now);
+            }
+            cfDirtyX0 = cfDirtyY0 = 0;
+            cfDirtyX1 = cfDirtyY1 = 200;
+        }
+
+        cfDirtyFull  = !samePanel;
+        cfPanelFace  = index;
+        cfPanelGen   = cfFaceGen;
+        cfPanelComps = hdr->compCount;
+    }
+
+    // Window-only tick. Only complications whose volatility class ticked
+    // since the panel last showed them are re-resolved; the dirty region is
+    // the boxes of those whose content changed. Then everything per-tick or
+    // UNDER that overlaps the byte-aligned window is redrawn in order; UNDER
+    // covers the same whole-byte widening, so nothing the fill clears is
+    // left blank. A redrawn complication whose content changed anyway (e.g.
+    // a battery reading moving inside its tick) widens the window and
+    // redraws it.
+    void renderWindow(const CfFaceHeader* hdr, const CfCompRec* recs,
+                      const uint8_t* rec, int now) {
+        for (int i = 0; i < hdr->compCount; i++) {
+            const CfCompRec& c = recs[i];
+            if (!(c.flags & CF_COMP_DYNAMIC) || c.vol == CF_VOL_SYNC) continue;
+            uint32_t key = volKey(c, now);
+            if (key == cfPanelKey[i]) continue;
+            cfPanelKey[i] = key;
+            CfResolved res;
+            resolveComplication(c, (const char*)rec + c.value, now, res);
+            if (res.hash == cfPanelHash[i]) continue;
+            cfPanelHash[i] = res.hash;
+            growDirty(c);
+        }
+
+        uint16_t bg = hdr->bg == CF_COLOR_BLACK ? GxEPD_BLACK : GxEPD_WHITE;
+        bool grown = true;
+        while (grown && cfDirtyX1 > cfDirtyX0 && cfDirtyY1 > cfDirtyY0) {
+            grown = false;
+            if (cfDirtyX0 < 0) cfDirtyX0 = 0;
+            if (cfDirtyY0 < 0) cfDirtyY0 = 0;
+            if (cfDirtyX1 > 200) cfDirtyX1 = 200;
+            if (cfDirtyY1 > 200) cfDirtyY1 = 200;
+            // The window is pushed whole bytes wide
+            int x0 = cfDirtyX0 & ~7, x1 = (cfDirtyX1 + 7) & ~7;
+            int y0 = cfDirtyY0, y1 = cfDirtyY1;
+            cfFrame.fillRect(x0, y0, x1 - x0, y1 - y0, bg);
+            for (int i = 0; i < hdr->compCount && !grown; i++) {
+                const CfCompRec& c = recs[i];
+                if (!(c.flags & (CF_COMP_DYNAMIC | CF_COMP_UNDER))) continue;
+                if (c.x >= x1 || c.x + c.w <= x0 || c.y >= y1 || c.y + c.h <= y0) continue;
+                uint32_t hash = renderComplication(c, (const char*)rec + c.value, now);
+                if (!(c.flags & CF_COMP_DYNAMIC) || hash == cfPanelHash[i]) continue;
+                cfPanelHash[i] = hash;
+                grown = c.x < x0 || c.x + c.w > x1 || c.y < y0 || c.y + c.h > y1;
+                growDirty(c);
+            }
+        }
+    }
+
+    void growDirty(const CfCompRec& c) {
+        if (c.x < cfDirtyX0) cfDirtyX0 = c.x;
+        if (c.y < cfDirtyY0) cfDirtyY0 = c.y;
+        if (c.x + c.w > cfDirtyX1) cfDirtyX1 = c.x + c.w;
+        if (c.y + c.h > cfDirtyY1) cfDirtyY1 = c.y + c.h;
+    }
+
+    // Changes exactly when the complication's volatility class ticks
+    uint32_t volKey(const CfCompRec& c, int now) {
+        switch (c.vol) {
+        case CF_VOL_MINUTE:  return (uint32_t)now / 60;
+        case CF_VOL_DAY:     return (uint32_t)now / 86400;
+        case CF_VOL_BATTERY: return (uint32_t)now / CF_BATTERY_TICK * 2 + isCharging();
+        case CF_VOL_STALE:   return compStale(c, now);
+        default:             return 0;
         }
     }
 
+    // Server complications only; stale <= 0 means never expires
+    bool compStale(const CfCompRec& c, int now) {
+        return !(c.flags & CF_COMP_LOCAL) && c.stale > 0 && cfLastSync > 0
+            && (now - cfLastSync) > c.stale;
+    }
+
+    // FNV-1a, used to detect complications whose drawn content changed
+    static uint32_t cfHash(const void* data, int len, uint32_t h = 2166136261u) {
+        const uint8_t* p = (const uint8_t*)data;
+        for (int i = 0; i < len; i++) { h ^= p[i]; h *= 16777619u; }
+        return h;
+    }
+
     // ---- Render single complication ----
 
-    void renderComplication(JsonObject comp, int now) {
-        int x           = comp["x"] | 0;
-        int y           = comp["y"] | 0;
-        int w           = comp["w"] | 0;
-        int h           = comp["h"] | 0;
-        int stale       = comp["stale"] | 60;
-        const char* val = comp["value"] | "";
-        const char* ff  = comp["font"] | "sans";
-        int sz          = comp["size"] | 16;
-        bool bold       = comp["bold"] | false;
-        const char* al  = comp["align"] | "left";
-        const char* col = comp["color"] | "black";
-        bool isLocal    = comp["local"] | false;
-        const char* typ = comp["type"] | "";
-        const char* cid = comp["id"] | "";
-        int bw          = comp["bw"] | 0;
-        int br          = comp["br"] | 0;
-        int bp          = comp["bp"] | 0;
-
-        // Resolve local values — check id first (type may be empty)
-        String localVal;
-        if (isLocal) {
-            localVal = resolveLocal(strlen(typ) > 0 ? typ : cid, comp);
-            val = localVal.c_str();
-        }
-
-        // Stale check (server complications only; stale <= 0 means never expires)
-        bool isStale = !isLocal && stale > 0 && cfLastSync > 0 && (now - cfLastSync) > stale;
-
-        const GFXfont* font = getFont(ff, sz, bold);
-        const GFXfont* boldFont = bold ? nullptr : getFont(ff, sz, true);
-        uint16_t color = (strcmp(col, "white") == 0) ? GxEPD_WHITE : GxEPD_BLACK;
+    // A complication's value as it would be drawn now. `val` may point into
+    // `local`, so a CfResolved is filled in place and never copied.
+    struct CfResolved {
+        const char* val;
+        char        local[16];
+        int         batPct;
+        bool        batCharging;
+        bool        isStale;
+        uint32_t    hash;   // everything that determines the drawn pixels
+    };
+
+    void resolveComplication(const CfCompRec& comp, const char* val, int now, CfResolved& out) {
+        out.batPct = 0;
+        out.batCharging = false;
+
+        // Resolve local values
+        if (comp.kind == CF_KIND_TIME || comp.kind == CF_KIND_DATE
+            || comp.kind == CF_KIND_VERSION) {
+            resolveLocal(comp, out.local, sizeof(out.local));
+            val = out.local;
+        }
+
+        // Battery: percentage or voltage text; the icon is keyed by its level
+        if (comp.kind == CF_KIND_BATTERY) {
+            if (comp.param == CF_BAT_ICON) {
+                out.batPct = batteryPercent(getBatteryVoltage());
+                out.batCharging = isCharging();
+                snprintf(out.local, sizeof(out.local), "%d%c", out.batPct, out.batCharging ? '+' : '-');
+            } else {
+                resolveBattery(comp.param, out.local, sizeof(out.local));
+            }
+            val = out.local;
+        }
+
+        out.val = val;
+        out.isStale = compStale(comp, now);
+
+        uint32_t hash = cfHash(&comp, sizeof(comp));
+        hash = cfHash(val, strlen(val), hash);
+        out.hash = cfHash(&out.isStale, 1, hash);
+    }
+
+    // Returns a hash of everything that determines the drawn pixels
+    // (record, resolved value, stale state) for dirty-rect tracking.
+    uint32_t renderComplication(const CfCompRec& comp, const char* val, int now) {
+        CfResolved res;
+        resolveComplication(comp, val, now, res);
+        drawComplication(comp, res);
+        return res.hash;
+    }
+
+    void drawComplication(const CfCompRec& comp, const CfResolved& res) {
+        int x        = comp.x;
+        int y        = comp.y;
+        int w        = comp.w;
+        int h        = comp.h;
+        bool bold    = comp.flags & CF_COMP_BOLD;
+
+        const GFXfont* font = getFont(comp.family, comp.size, bold, res.val);
+        const GFXfont* boldFont = bold ? nullptr : getFont(comp.family, comp.size, true, res.val);
+        uint16_t color = (comp.flags & CF_COMP_WHITE) ? GxEPD_WHITE : GxEPD_BLACK;
 
         // Draw border if configured
-        if (bw > 0) {
-            drawBorder(x, y, w, h, bw, br, color);
+        if (comp.bw > 0) {
+            drawBorder(x, y, w, h, comp.bw, comp.br, color);
         }
 
         // Inset text area by border width + padding (only when border exists)
-        int inset = (bw > 0) ? (bw + bp) : 0;
-        int pt = comp["pt"] | 0;
-        int pl = comp["pl"] | 0;
-        int tx = x + inset + pl;
-        int ty = y + inset + pt;
-        int tw = w - inset * 2 - pl;
-        int th = h - inset * 2 - pt;
+        int inset = (comp.bw > 0) ? (comp.bw + comp.bp) : 0;
+        int tx = x + inset + comp.pl;
+        int ty = y + inset + comp.pt;
+        int tw = w - inset * 2 - comp.pl;
+        int th = h - inset * 2 - comp.pt;
         if (tw < 1) tw = 1;
         if (th < 1) th = 1;
 
-        // Battery: check display param (icon/percentage/voltage)
-        const char* effType = strlen(typ) > 0 ? typ : cid;
-        String batVal; // must outlive val pointer
-        if (isLocal && strcmp(effType, "battery") == 0) {
-            const char* batDisplay = comp["params"]["display"] | "icon";
-            if (strcmp(batDisplay, "icon") == 0) {
-                drawBatteryIcon(tx, ty, tw, th, color);
-                return;
-            }
-            batVal = resolveBattery(batDisplay);
-            val = batVal.c_str();
+        if (comp.kind == CF_KIND_BATTERY && comp.param == CF_BAT_ICON) {
+            drawBatteryIcon(tx, ty, tw, th, color, res.batPct, res.batCharging);
+            return;
         }
 
-        // Weather icon: value "icon:CODE" or "icon:CODE:SIZE"
-        if (strncmp(val, "icon:", 5) == 0) {
-            int weatherCode = atoi(val + 5);
-            // Parse optional size after second colon
-            const char* sizeStr = strchr(val + 5, ':');
-            int iconSize = sizeStr ? atoi(sizeStr + 1) : 0;
+        // Weather icon, optionally centred at a fixed size
+        if (comp.kind == CF_KIND_ICON) {
+            int iconSize = comp.param2;
             if (iconSize > 0 && iconSize < tw && iconSize < th) {
                 // Center icon at specified size within bounding box
                 int ox = tx + (tw - iconSize) / 2;
                 int oy = ty + (th - iconSize) / 2;
-                drawWeatherIcon(weatherCode, ox, oy, iconSize, iconSize, color);
+                drawWeatherIcon(comp.param, ox, oy, iconSize, iconSize, color);
             } else {
-                drawWeatherIcon(weatherCode, tx, ty, tw, th, color);
+                drawWeatherIcon(comp.param, tx, ty, tw, th, color);
             }
             return;
         }
 
-        if (isStale) {
-            drawItalic(val, tx, ty, tw, th, al, font, color);
-        } else {
-            drawAligned(val, tx, ty, tw, th, al, font, color, boldFont);
-        }
+        // Stale values are drawn oblique, without bold lines
+        drawAligned(res.val, tx, ty, tw, th, comp.align, font, color,
+                    res.isStale ? nullptr : boldFont, res.isStale);
     }
 
     // ---- Draw border (rect or rounded rect) ----
 
+    // Outer radius br, inner radius br - bw, one or two spans per row
     void drawBorder(int x, int y, int w, int h, int bw, int br, uint16_t color) {
-        if (br <= 0) {
-            // Simple rectangle border
-            for (int i = 0; i < bw; i++) {
-                display.drawRect(x + i, y + i, w - 2 * i, h - 2 * i, color);
-            }
-        } else {
-            // Rounded rectangle border
-            int r = br;
-            if (r > w / 2) r = w / 2;
-            if (r > h / 2) r = h / 2;
-            for (int i = 0; i < bw; i++) {
-                display.drawRoundRect(x + i, y + i, w - 2 * i, h - 2 * i, r, color);
-                if (r > 1) r--;
-            }
-        }
+        cfFrame.drawRoundFrame(x, y, w, h, br > 0 ? br : 0, bw, color);
     }
 
     // ---- Battery helpers ----
@@ -1288,11 +2783,7 @@ private:
 
     // ---- Battery icon ----
 
-    void drawBatteryIcon(int x, int y, int w, int h, uint16_t color) {
-        float v = getBatteryVoltage();
-        int pct = batteryPercent(v);
-        bool charging = isCharging();
-
+    void drawBatteryIcon(int x, int y, int w, int h, uint16_t color, int pct, bool charging) {
         // Body dimensions (leave room for nub on right)
         int nubW = 2;
         int gap = 1;
@@ -1300,20 +2791,20 @@ private:
         if (bodyW < 6) bodyW = 6;
 
         // Body outline
-        display.drawRect(x, y, bodyW, h, color);
+        cfFrame.drawRect(x, y, bodyW, h, color);
 
         // Nub (centered vertically on right side)
         int nubH = h * 2 / 5;
         if (nubH < 2) nubH = 2;
         int nubY = y + (h - nubH) / 2;
-        display.fillRect(x + bodyW + gap, nubY, nubW, nubH, color);
+        cfFrame.fillRect(x + bodyW + gap, nubY, nubW, nubH, color);
 
         // Fill proportional to charge (2px inset from body edge)
         int pad = 2;
         int maxFillW = bodyW - pad * 2;
         int fillW = (maxFillW * pct) / 100;
         if (fillW > 0) {
-            display.fillRect(x + pad, y + pad, fillW, h - pad * 2, color);
+            cfFrame.fillRect(x + pad, y + pad, fillW, h - pad * 2, color);
         }
 
         // Charging: draw lightning bolt centered in body
@@ -1327,37 +2818,33 @@ private:
             int top = cy - bh / 2;
             // Invert color over the fill for contrast
             uint16_t boltColor = (pct > 40) ? (color == GxEPD_BLACK ? GxEPD_WHITE : GxEPD_BLACK) : color;
-            // Simple bolt: top-right to center-left, then center-right to bottom-left
-            display.drawLine(cx + bw / 2, top, cx - bw / 2, cy, boltColor);
-            display.drawLine(cx - bw / 2, cy, cx + bw / 2, cy, boltColor);
-            display.drawLine(cx + bw / 2, cy, cx - bw / 2, top + bh, boltColor);
-            // Thicken by drawing offset lines
-            display.drawLine(cx + bw / 2 + 1, top, cx - bw / 2 + 1, cy, boltColor);
-            display.drawLine(cx + bw / 2 + 1, cy, cx - bw / 2 + 1, top + bh, boltColor);
+            // Simple bolt: top-right to center-left, then center-right to
+            // bottom-left, the diagonals 2px thick
+            cfFrame.drawThickLine(cx + bw / 2, top, cx - bw / 2, cy, 2, boltColor);
+            cfFrame.drawLine(cx - bw / 2, cy, cx + bw / 2, cy, boltColor);
+            cfFrame.drawThickLine(cx + bw / 2, cy, cx - bw / 2, top + bh, 2, boltColor);
         }
     }
 
     // ---- Battery text (percentage or voltage) ----
 
-    String resolveBattery(const char* mode) {
+    void resolveBattery(uint8_t mode, char* buf, int bufSize) {
         float v = getBatteryVoltage();
-        char buf[12];
         bool charging = isCharging();
-        if (strcmp(mode, "percentage") == 0) {
+        if (mode == CF_BAT_PERCENT) {
             int pct = batteryPercent(v);
             if (charging) {
-                snprintf(buf, sizeof(buf), "%d%% +", pct);
+                snprintf(buf, bufSize, "%d%% +", pct);
             } else {
-                snprintf(buf, sizeof(buf), "%d%%", pct);
+                snprintf(buf, bufSize, "%d%%", pct);
             }
         } else {
             if (charging) {
-                snprintf(buf, sizeof(buf), "%.1fV +", v);
+                snprintf(buf, bufSize, "%.1fV +", v);
             } else {
-                snprintf(buf, sizeof(buf), "%.1fV", v);
+                snprintf(buf, bufSize, "%.1fV", v);
             }
         }
-        return String(buf);
     }
 
     // ---- Weather icons ----
@@ -1370,18 +2857,18 @@ private:
         int baseW = s * 3 / 4;
         int baseY = cy + r2 / 2;
         // Flat base
-        display.fillRect(cx - baseW / 2, baseY, baseW, baseH, color);
+        cfFrame.fillRect(cx - baseW / 2, baseY, baseW, baseH, color);
         // Left bump
-        display.fillCircle(cx - baseW / 4, baseY, r2, color);
+        cfFrame.fillCircle(cx - baseW / 4, baseY, r2, color);
         // Center bump (taller)
-        display.fillCircle(cx, baseY - r1 / 3, r1, color);
+        cfFrame.fillCircle(cx, baseY - r1 / 3, r1, color);
         // Right bump
-        display.fillCircle(cx + baseW / 4, baseY, r2 - 1, color);
+        cfFrame.fillCircle(cx + baseW / 4, baseY, r2 - 1, color);
     }
 
     void drawSunIcon(int cx, int cy, int s, uint16_t color) {
         int r = s / 5;
-        display.fillCircle(cx, cy, r, color);
+        cfFrame.fillCircle(cx, cy, r, color);
         // 8 rays using integer offsets (x10 scale: 10,0 / 7,7 / 0,10 / etc.)
         const int dx[] = {10, 7, 0, -7, -10, -7, 0, 7};
         const int dy[] = {0, -7, -10, -7, 0, 7, 10, 7};
@@ -1392,7 +2879,7 @@ private:
             int y1 = cy + dy[i] * inner / 10;
             int x2 = cx + dx[i] * outer / 10;
             int y2 = cy + dy[i] * outer / 10;
-            display.drawLine(x1, y1, x2, y2, color);
+            cfFrame.drawLine(x1, y1, x2, y2, color);
         }
     }
 
@@ -1411,9 +2898,9 @@ private:
             int ly = y + i * h / 5;
             int lx = x + pad + (i % 2 == 0 ? pad / 2 : 0);
             int lw = w - pad * 2 - (i % 2 == 0 ? pad / 2 : 0);
-            display.drawLine(lx, ly, lx + lw, ly, color);
+            cfFrame.drawLine(lx, ly, lx + lw, ly, color);
             if (lineH > 1) {
-                display.drawLine(lx, ly + 1, lx + lw, ly + 1, color);
+                cfFrame.drawLine(lx, ly + 1, lx + lw, ly + 1, color);
             }
         }
     }
@@ -1425,8 +2912,7 @@ private:
         for (int i = 0; i < count; i++) {
             int dx = startX + i * spacing;
             // Slight angle on drops
-            display.drawLine(dx, cy, dx - 1, cy + dropH, color);
-            display.drawLine(dx + 1, cy, dx, cy + dropH, color);
+            cfFrame.drawThickLine(dx, cy, dx - 1, cy + dropH, 2, color);
         }
     }
 
@@ -1439,7 +2925,7 @@ private:
             int offset = row * spacing / 2;
             for (int i = 0; i < 3 - row; i++) {
                 int dx = startX + offset + i * spacing;
-                display.fillCircle(dx, dy, 1, color);
+                cfFrame.fillCircle(dx, dy, 1, color);
             }
         }
     }
@@ -1447,366 +2933,249 @@ private:
     void drawLightningBolt(int cx, int cy, int s, uint16_t color) {
         int bh = s * 2 / 5;
         int bw = s / 6;
-        // Zigzag: top-right → center-left → center-right → bottom-left
-        display.drawLine(cx + bw, cy, cx - bw / 2, cy + bh / 2, color);
-        display.drawLine(cx - bw / 2, cy + bh / 2, cx + bw / 2, cy + bh / 2, color);
-        display.drawLine(cx + bw / 2, cy + bh / 2, cx - bw, cy + bh, color);
-        // Thicken
-        display.drawLine(cx + bw + 1, cy, cx - bw / 2 + 1, cy + bh / 2, color);
-        display.drawLine(cx + bw / 2 + 1, cy + bh / 2, cx - bw + 1, cy + bh, color);
+        // Zigzag: top-right → center-left → center-right → bottom-left,
+        // the diagonals 2px thick
+        cfFrame.drawThickLine(cx + bw, cy, cx - bw / 2, cy + bh / 2, 2, color);
+        cfFrame.drawLine(cx - bw / 2, cy + bh / 2, cx + bw / 2, cy + bh / 2, color);
+        cfFrame.drawThickLine(cx + bw / 2, cy + bh / 2, cx - bw, cy + bh, 2, color);
+    }
+
+    // Met Office code → icon bucket (glyph index in the WeatherIcons atlas)
+    static uint8_t weatherIconBucket(int code) {
+        if (code <= 1)  return 0;  // Clear / Sunny
+        if (code <= 3)  return 1;  // Partly cloudy
+        if (code <= 6)  return 2;  // Mist / Fog
+        if (code <= 8)  return 3;  // Cloudy / Overcast
+        if (code <= 12) return 4;  // Light rain / showers / drizzle
+        if (code <= 15) return 5;  // Heavy rain / heavy showers
+        if (code <= 27) return 6;  // Sleet, hail, snow
+        if (code <= 30) return 7;  // Thunder
+        return 3;                  // Unknown — just draw a cloud
     }
 
+    // Square icons at the sizes the weather sources offer are blitted from
+    // the atlas tools/weathericons.py prerenders from the geometry below
+    // (regenerate it when changing the drawing); other boxes are drawn.
     void drawWeatherIcon(int code, int x, int y, int w, int h, uint16_t color) {
+        uint8_t bucket = weatherIconBucket(code);
+        if (w == h) {
+            for (const GFXfont* set : WeatherIconSets) {
+                if (set->yAdvance == w) {
+                    cfFrame.drawGlyph(set, bucket, x, y, color, 0, 0, CfCanvas::W, CfCanvas::H);
+                    return;
+                }
+            }
+        }
+
         int cx = x + w / 2;
         int cy = y + h / 2;
         int s = (w < h) ? w : h;
 
-        if (code <= 1) {
-            // Clear / Sunny
+        switch (bucket) {
+        case 0:
             drawSunIcon(cx, cy, s, color);
-        } else if (code <= 3) {
-            // Partly cloudy
+            break;
+        case 1:
             drawPartCloudIcon(cx, cy, s, color);
-        } else if (code <= 6) {
-            // Mist / Fog
+            break;
+        case 2:
             drawFogIcon(x, y, w, h, color);
-        } else if (code <= 8) {
-            // Cloudy / Overcast
+            break;
+        case 3:
             drawCloudShape(cx, cy - s / 8, s, color);
-        } else if (code <= 12) {
-            // Light rain / showers / drizzle
+            break;
+        case 4:
             drawCloudShape(cx, cy - s / 4, s, color);
             drawRainDrops(cx, cy + s / 5, s, 3, color);
-        } else if (code <= 15) {
-            // Heavy rain / heavy showers
+            break;
+        case 5:
             drawCloudShape(cx, cy - s / 4, s, color);
             drawRainDrops(cx, cy + s / 5, s, 5, color);
-        } else if (code <= 27) {
-            // Sleet, hail, snow
+            break;
+        case 6:
             drawCloudShape(cx, cy - s / 4, s, color);
             drawSnowDots(cx, cy + s / 5, s, color);
-        } else if (code <= 30) {
-            // Thunder
+            break;
+        default:
             drawCloudShape(cx, cy - s / 4, s, color);
             drawLightningBolt(cx, cy + s / 6, s, color);
-        } else {
-            // Unknown — just draw a cloud
-            drawCloudShape(cx, cy - s / 8, s, color);
+            break;
         }
     }
 
     // ---- Local complication values ----
 
-    String resolveLocal(const char* type, JsonObject comp) {
-        if (strcmp(type, "time") == 0) {
-            const char* layout = comp["params"]["layout"] | "horizontal";
-            if (strcmp(layout, "vertical") == 0) {
-                char buf[6];
-                snprintf(buf, sizeof(buf), "%02d\n%02d",
-                         currentTime.Hour, currentTime.Minute);
-                return String(buf);
-            }
-            char buf[6];
-            snprintf(buf, sizeof(buf), "%02d:%02d",
+    void resolveLocal(const CfCompRec& comp, char* buf, int bufSize) {
+        if (comp.kind == CF_KIND_TIME) {
+            snprintf(buf, bufSize, comp.param == 1 ? "%02d\n%02d" : "%02d:%02d",
                      currentTime.Hour, currentTime.Minute);
-            return String(buf);
-        }
-        if (strcmp(type, "version") == 0) {
-            return String("v" CRISPFACE_VERSION);
+            return;
         }
-        if (strcmp(type, "date") == 0) {
-            static const char* days[] =
-                {"Sun","Mon","Tue","Wed","Thu","Fri","Sat"};
-            static const char* mons[] =
-                {"Jan","Feb","Mar","Apr","May","Jun",
-                 "Jul","Aug","Sep","Oct","Nov","Dec"};
-            int dow = currentTime.Wday - 1; // Wday is 1-7 (Sun=1), array is 0-6
-            int mon = currentTime.Month - 1;
-            if (dow < 0 || dow > 6) dow = 0;
-            if (mon < 0 || mon > 11) mon = 0;
-            char buf[16];
-            snprintf(buf, sizeof(buf), "%s %d %s",
-                     days[dow], currentTime.Day, mons[mon]);
-            return String(buf);
+        if (comp.kind == CF_KIND_VERSION) {
+            snprintf(buf, bufSize, "v" CRISPFACE_VERSION);
+            return;
         }
-        return String(type);
+        // CF_KIND_DATE
+        static const char* days[] =
+            {"Sun","Mon","Tue","Wed","Thu","Fri","Sat"};
+        static const char* mons[] =
+            {"Jan","Feb","Mar","Apr","May","Jun",
+             "Jul","Aug","Sep","Oct","Nov","Dec"};
+        int dow = currentTime.Wday - 1; // Wday is 1-7 (Sun=1), array is 0-6
+        int mon = currentTime.Month - 1;
+        if (dow < 0 || dow > 6) dow = 0;
+        if (mon < 0 || mon > 11) mon = 0;
+        snprintf(buf, bufSize, "%s %d %s",
+                 days[dow], currentTime.Day, mons[mon]);
     }
 
     // ---- Draw multi-line aligned text ----
 
-    void drawAligned(const char* text, int bx, int by, int bw, int bh,
-                     const char* align, const GFXfont* font, uint16_t color,
-                     const GFXfont* boldFont = nullptr) {
-        display.setFont(font);
-
-        int16_t tx, ty;
-        uint16_t tw, th;
-        display.getTextBounds("Ay", 0, 0, &tx, &ty, &tw, &th);
-        int ascent = -(int)ty;  // distance from baseline to top of tallest char
-        int lineH = (int)th + 2;
-
-        String str(text);
+    // One laid-out line of a value. Marker bytes at the start of a line are
+    // consumed by layoutText(): \x04 + day name is a ———Mon——— divider,
+    // \x03 draws the line bold, \x01/\x02 put a filled/open circle before
+    // it (all-day events).
+    struct CfLine {
+        const char*    text;     // into the value, markers stripped
+        uint16_t       len;
+        uint8_t        marker;   // CF_LINE_*
+        int8_t         scale;    // drawGlyph() scale of `font`
+        int8_t         skew;     // drawGlyph() shear (stale, no oblique variant)
+        const GFXfont* font;     // drawn with (bold / oblique variant applied)
+        int16_t        x;        // left edge of the circle or text
+        int16_t        width;    // text advance width
+        int16_t        baseline;
+    };
+    enum : uint8_t { CF_LINE_TEXT = 0, CF_LINE_FILLED, CF_LINE_OPEN, CF_LINE_DIVIDER };
+    static const int CF_MAX_LINES = 24; // more than a 200px box can show
+
+    // Splits `text` into lines and measures and places each one in a
+    // single pass, stopping at the first line whose baseline falls below
+    // the box. `oblique` (stale data) swaps in the font's oblique variant,
+    // or failing that shears the upright glyphs by the same amount; bold
+    // lines stay upright-weight then. Returns the line count.
+    int layoutText(const char* text, int bx, int by, int bw, int bh, uint8_t align,
+                   const GFXfont* font, const GFXfont* boldFont, bool oblique,
+                   CfLine* lines, int maxLines) {
+        GFXMetrics fm = fontMetrics(font);
+        int ascent = fm.ascent;  // distance from baseline to top of tallest char
+        int lineH = fm.ascent + fm.descent + 2;
+        const GFXfont* obFont = oblique ? obliqueFont(font) : nullptr;
+        int skew = (oblique && !obFont) ? obliqueSkew(fm) : 0;
+        if (oblique) boldFont = nullptr;
+
+        int n = 0;
         int curY = by + ascent; // baseline so text top aligns with top of area
-        int idx = 0;
-        bool firstLine = true;
-
-        while (idx <= (int)str.length() && (firstLine || (curY - by) <= bh)) {
-            int nl = str.indexOf('\n', idx);
-            String line = (nl < 0) ? str.substring(idx)
-                                   : str.substring(idx, nl);
-            idx = (nl < 0) ? str.length() + 1 : nl + 1;
-
-            const char* linePtr = line.c_str();
-
-            // Day divider: \x04 + day name renders as ———Mon——— divider
-            if ((uint8_t)linePtr[0] == 0x04) {
-                const char* dayLabel = linePtr + 1;
-                int lineW = bw < 120 ? bw : 120;
-                int lx = bx + (bw - lineW) / 2;
-                // Use smallest font for day label
-                display.setFont(&FreeSans9pt7b);
-                int16_t dtx, dty; uint16_t dtw, dth;
-                display.getTextBounds(dayLabel, 0, 0, &dtx, &dty, &dtw, &dth);
-                int divAscent = -(int)dty;
-                int labelH = (int)dth;
-                // Visual text spans from cursor+dtx to cursor+dtx+dtw
-                // Centre the visual text within bw
-                int cursorX = bx + (bw - (int)dtw) / 2 - (int)dtx;
-                int textLeft = cursorX + (int)dtx;
-                int textRight = textLeft + (int)dtw;
-                int ly = curY - ascent + 1;
-                int baseline = ly + divAscent;
-                int cy = ly + labelH / 2;
-                display.setCursor(cursorX, baseline);
-                display.setTextColor(color);
-                display.print(dayLabel);
-                // Lines either side with 3px gap
-                int gap = 3;
-                if (textLeft - gap - 1 >= lx)
-                    display.drawLine(lx, cy, textLeft - gap - 1, cy, color);
-                if (textRight + gap <= lx + lineW - 1)
-                    display.drawLine(textRight + gap, cy, lx + lineW - 1, cy, color);
+        const char* p = text;
+        while (n < maxLines && (n == 0 || (curY - by) <= bh)) {
+            const char* end = strchr(p, '\n');
+            if (!end) end = p + strlen(p);
+            CfLine& ln = lines[n++];
+            ln.text = p;
+            ln.marker = CF_LINE_TEXT;
+            ln.scale = 1;
+            ln.skew = 0;
+
+            if ((uint8_t)*p == 0x04) {
+                // Day label in the smallest font, centred within bw
+                GFXMetrics dm = fontMetrics(&FreeSans9pt7b);
+                int labelH = dm.ascent + dm.descent;
+                ln.text = p + 1;
+                ln.len = (uint16_t)(end - ln.text);
+                ln.marker = CF_LINE_DIVIDER;
+                ln.font = &FreeSans9pt7b;
+                ln.width = measureText(&FreeSans9pt7b, ln.text, ln.len);
+                ln.x = bx + (bw - ln.width) / 2;
+                ln.baseline = curY - ascent + 1 + dm.ascent;
                 curY += labelH + 4;
-                display.setFont(font);
-                firstLine = false;
-                continue;
-            }
-
-            // Check for bold marker byte (\x03 = render this line in bold)
-            bool useBold = false;
-            if ((uint8_t)linePtr[0] == 0x03) { useBold = true; linePtr++; }
-
-            // Check for circle marker bytes (all-day event indicators)
-            bool drawFilledCircle = false;
-            bool drawOpenCircle = false;
-            if ((uint8_t)linePtr[0] == 0x01) { drawFilledCircle = true; linePtr++; }
-            else if ((uint8_t)linePtr[0] == 0x02) { drawOpenCircle = true; linePtr++; }
-            if ((drawFilledCircle || drawOpenCircle) && linePtr[0] == ' ') linePtr++;
-
-            // Select font for this line (bold variant if marked and available)
-            const GFXfont* lineFont = (useBold && boldFont) ? boldFont : font;
-            display.setFont(lineFont);
-
-            // Use linePtr (markers stripped) for measurement
-            display.getTextBounds(linePtr, 0, 0, &tx, &ty, &tw, &th);
-
-            // Account for circle width in alignment
-            int circleW = 0;
-            if (drawFilledCircle || drawOpenCircle) {
-                int cr = ascent / 4;
-                circleW = cr * 2 + 3;
-            }
-
-            int curX;
-            if (strcmp(align, "center") == 0)
-                curX = bx + (bw - (int)tw - circleW) / 2;
-            else if (strcmp(align, "right") == 0)
-                curX = bx + bw - (int)tw - circleW;
-            else
-                curX = bx;
-
-            // Draw circle marker if present
-            int penX = curX;
-            if (drawFilledCircle || drawOpenCircle) {
-                int cr = ascent / 4;
-                int cy = curY - ascent / 2;
-                int cx = curX + cr;
-                if (drawFilledCircle) display.fillCircle(cx, cy, cr, color);
-                else display.drawCircle(cx, cy, cr, color);
-                penX = curX + cr * 2 + 3;
-            }
-
-            // Render glyph-by-glyph with pixel clipping to bounds
-            int lineLen = (int)strlen(linePtr);
-            for (int i = 0; i < lineLen; i++) {
-                uint8_t c = (uint8_t)linePtr[i];
-                if (c < lineFont->first || c > lineFont->last) continue;
-
-                GFXglyph *gl = &lineFont->glyph[c - lineFont->first];
-                uint8_t  *bm = lineFont->bitmap;
-                uint16_t  bo = gl->bitmapOffset;
-                uint8_t   gw = gl->width;
-                uint8_t   gh = gl->height;
-                int8_t    xo = gl->xOffset;
-                int8_t    yo = gl->yOffset;
-
-                uint8_t bit = 0, bits = 0;
-                for (int row = 0; row < gh; row++) {
-                    for (int col = 0; col < gw; col++) {
-                        if (!(bit++ & 7))
-                            bits = pgm_read_byte(&bm[bo++]);
-                        if (bits & 0x80) {
-                            int px = penX + xo + col;
-                            int py = curY + yo + row;
-                            if (px >= bx && px < bx + bw &&
-                                py >= by && py < by + bh)
-                                display.drawPixel(px, py, color);
-                        }
-                        bits <<= 1;
-                    }
+            } else {
+                bool useBold = false;
+                if ((uint8_t)*p == 0x03) { useBold = true; p++; }
+                if ((uint8_t)*p == 0x01) { ln.marker = CF_LINE_FILLED; p++; }
+                else if ((uint8_t)*p == 0x02) { ln.marker = CF_LINE_OPEN; p++; }
+                if (ln.marker != CF_LINE_TEXT && *p == ' ') p++;
+                ln.text = p;
+                ln.len = (uint16_t)(end - p);
+
+                // Bold variant if marked and available
+                const GFXfont* lineFont = (useBold && boldFont) ? boldFont : font;
+                ln.width = measureText(lineFont, ln.text, ln.len);
+                if (obFont) {
+                    ln.font = obFont;
+                } else {
+                    ln.font = lineFont;
+                    ln.scale = (lineFont == font) ? fm.scale : fontMetrics(lineFont).scale;
+                    ln.skew = skew;
                 }
-                penX += gl->xAdvance;
+
+                // Account for circle width in alignment
+                int circleW = (ln.marker != CF_LINE_TEXT) ? (ascent / 4) * 2 + 3 : 0;
+                if (align == CF_ALIGN_CENTER)
+                    ln.x = bx + (bw - ln.width - circleW) / 2;
+                else if (align == CF_ALIGN_RIGHT)
+                    ln.x = bx + bw - ln.width - circleW;
+                else
+                    ln.x = bx;
+                ln.baseline = curY;
+                curY += lineH;
             }
-            // Restore base font for next line's metrics consistency
-            display.setFont(font);
-            firstLine = false;
-            curY += lineH;
+            if (!*end) break;
+            p = end + 1;
         }
+        return n;
     }
 
-    // ---- Fake italic via per-row pixel skew ----
-
-    void drawItalic(const char* text, int bx, int by, int bw, int bh,
-                    const char* align, const GFXfont* font, uint16_t color) {
-        display.setFont(font);
-
-        int16_t tx, ty;
-        uint16_t tw, th;
-        display.getTextBounds("Ay", 0, 0, &tx, &ty, &tw, &th);
-        int ascent = -(int)ty;
-        int lineH = (int)th + 2;
-        int skew = lineH / 5;
-        if (skew < 1) skew = 1;
-
-        String str(text);
-        int curY = by + ascent;
-        int idx = 0;
-        bool firstLine = true;
-
-        while (idx <= (int)str.length() && (firstLine || (curY - by) <= bh)) {
-            int nl = str.indexOf('\n', idx);
-            String line = (nl < 0) ? str.substring(idx)
-                                   : str.substring(idx, nl);
-            idx = (nl < 0) ? str.length() + 1 : nl + 1;
-
-            const char* linePtr = line.c_str();
-
-            // Day divider: \x04 + day name renders as ———Mon——— divider
-            if ((uint8_t)linePtr[0] == 0x04) {
-                const char* dayLabel = linePtr + 1;
+    void drawAligned(const char* text, int bx, int by, int bw, int bh,
+                     uint8_t align, const GFXfont* font, uint16_t color,
+                     const GFXfont* boldFont = nullptr, bool oblique = false) {
+        CfLine lines[CF_MAX_LINES];
+        int n = layoutText(text, bx, by, bw, bh, align, font, boldFont, oblique, lines, CF_MAX_LINES);
+        int ascent = fontMetrics(font).ascent;
+
+        for (int l = 0; l < n; l++) {
+            const CfLine& ln = lines[l];
+            int penX = ln.x;
+            int cx = bx, cy = by, cw = bw, ch = bh; // glyph clip
+
+            if (ln.marker == CF_LINE_DIVIDER) {
+                // Label unclipped, with lines either side with 3px gap
+                GFXMetrics dm = fontMetrics(&FreeSans9pt7b);
                 int lineW = bw < 120 ? bw : 120;
                 int lx = bx + (bw - lineW) / 2;
-                display.setFont(&FreeSans9pt7b);
-                int16_t dtx, dty; uint16_t dtw, dth;
-                display.getTextBounds(dayLabel, 0, 0, &dtx, &dty, &dtw, &dth);
-                int divAscent = -(int)dty;
-                int labelH = (int)dth;
-                int cursorX = bx + (bw - (int)dtw) / 2 - (int)dtx;
-                int textLeft = cursorX + (int)dtx;
-                int textRight = textLeft + (int)dtw;
-                int ly = curY - ascent + 1;
-                int baseline = ly + divAscent;
-                int cy = ly + labelH / 2;
-                display.setCursor(cursorX, baseline);
-                display.setTextColor(color);
-                display.print(dayLabel);
+                int ly = ln.baseline - dm.ascent + (dm.ascent + dm.descent) / 2;
                 int gap = 3;
-                if (textLeft - gap - 1 >= lx)
-                    display.drawLine(lx, cy, textLeft - gap - 1, cy, color);
-                if (textRight + gap <= lx + lineW - 1)
-                    display.drawLine(textRight + gap, cy, lx + lineW - 1, cy, color);
-                curY += labelH + 4;
-                display.setFont(font);
-                firstLine = false;
-                continue;
-            }
-
-            // Check for circle marker bytes (all-day event indicators)
-            bool drawFilledCircle = false;
-            bool drawOpenCircle = false;
-            if ((uint8_t)linePtr[0] == 0x01) { drawFilledCircle = true; linePtr++; }
-            else if ((uint8_t)linePtr[0] == 0x02) { drawOpenCircle = true; linePtr++; }
-            if ((drawFilledCircle || drawOpenCircle) && linePtr[0] == ' ') linePtr++;
-
-            const char* measStr = (drawFilledCircle || drawOpenCircle) ? linePtr : line.c_str();
-            display.getTextBounds(measStr, 0, 0, &tx, &ty, &tw, &th);
-
-            int circleW = 0;
-            if (drawFilledCircle || drawOpenCircle) {
+                if (ln.x - gap - 1 >= lx)
+                    cfFrame.drawLine(lx, ly, ln.x - gap - 1, ly, color);
+                if (ln.x + ln.width + gap <= lx + lineW - 1)
+                    cfFrame.drawLine(ln.x + ln.width + gap, ly, lx + lineW - 1, ly, color);
+                cx = 0; cy = 0; cw = CfCanvas::W; ch = CfCanvas::H;
+            } else if (ln.marker != CF_LINE_TEXT) {
                 int cr = ascent / 4;
-                circleW = cr * 2 + 3;
+                int ccy = ln.baseline - ascent / 2;
+                if (ln.marker == CF_LINE_FILLED) cfFrame.fillCircle(ln.x + cr, ccy, cr, color);
+                else cfFrame.drawCircle(ln.x + cr, ccy, cr, color);
+                penX += cr * 2 + 3;
             }
 
-            int baseX;
-            if (strcmp(align, "center") == 0)
-                baseX = bx + (bw - (int)tw - circleW) / 2;
-            else if (strcmp(align, "right") == 0)
-                baseX = bx + bw - (int)tw - circleW;
-            else
-                baseX = bx;
-
-            // Draw circle marker if present
-            int penX = baseX;
-            if (drawFilledCircle || drawOpenCircle) {
-                int cr = ascent / 4;
-                int cy = curY - ascent / 2;
-                int cx = baseX + cr;
-                if (drawFilledCircle) display.fillCircle(cx, cy, cr, color);
-                else display.drawCircle(cx, cy, cr, color);
-                penX = baseX + cr * 2 + 3;
-            }
-
-            // Render each glyph with X shear
-            int lineLen = (drawFilledCircle || drawOpenCircle) ? (int)strlen(linePtr) : (int)line.length();
-            const char* renderStr = (drawFilledCircle || drawOpenCircle) ? linePtr : line.c_str();
-            for (int i = 0; i < lineLen; i++) {
-                uint8_t c = (uint8_t)renderStr[i];
-                if (c < font->first || c > font->last) continue;
-
-                GFXglyph *gl = &font->glyph[c - font->first];
-                uint8_t  *bm = font->bitmap;
-                uint16_t  bo = gl->bitmapOffset;
-                uint8_t   gw = gl->width;
-                uint8_t   gh = gl->height;
-                int8_t    xo = gl->xOffset;
-                int8_t    yo = gl->yOffset;
-
-                uint8_t bit = 0, bits = 0;
-                for (int row = 0; row < gh; row++) {
-                    int shear = (int)((float)(gh - row) * skew / gh);
-                    for (int col = 0; col < gw; col++) {
-                        if (!(bit++ & 7))
-                            bits = pgm_read_byte(&bm[bo++]);
-                        if (bits & 0x80) {
-                            int px = penX + xo + col + shear;
-                            int py = curY + yo + row;
-                            if (px >= bx && px < bx + bw &&
-                                py >= by && py < by + bh)
-                                display.drawPixel(px, py, color);
-                        }
-                        bits <<= 1;
-                    }
-                }
-                penX += gl->xAdvance;
+            // Glyph by glyph, clipped. Codepoints outside the font, or
+            // dropped from a glyph subset (zero advance), are skipped.
+            const GFXfont* f = ln.font;
+            for (int i = 0; i < ln.len; i++) {
+                uint8_t c = (uint8_t)ln.text[i];
+                if (c < f->first || c > f->last) continue;
+                int adv = f->glyph[c - f->first].xAdvance;
+                if (adv == 0) continue;
+                cfFrame.drawGlyph(f, c, penX, ln.baseline, color, cx, cy, cw, ch, ln.skew, ln.scale);
+                penX += adv * ln.scale;
             }
-            firstLine = false;
-            curY += lineH;
         }
     }
 
     // ---- Boot screen (shown on every boot/reboot before first sync) ----
 
     void renderBootScreen() {
+        cfPanelFace = -1; // panel no longer shows a face frame
+        cfPanelFrame = 0;
         display.setFullWindow();
         display.fillScreen(GxEPD_BLACK);
         display.setTextColor(GxEPD_WHITE);
@@ -1833,7 +3202,7 @@ private:
 
         // Time
         display.setFont(&FreeSans24pt7b);
-        char tbuf[6];
+        char tbuf[8];
         snprintf(tbuf, sizeof(tbuf), "%02d:%02d",
                  currentTime.Hour, currentTime.Minute);
         display.getTextBounds(tbuf, 0, 0, &tx, &ty, &tw, &th);
@@ -1853,39 +3222,39 @@ private:
     // ---- Fallback screen (no faces after sync) ----
 
     void renderFallback() {
-        display.setFullWindow();
-        display.fillScreen(GxEPD_BLACK);
-        display.setTextColor(GxEPD_WHITE);
+        cfPanelFace = -1; // panel no longer shows a face frame
+        cfFrame.fillScreen(GxEPD_BLACK);
+        cfFrame.setTextColor(GxEPD_WHITE);
 
         int16_t tx, ty;
         uint16_t tw, th;
 
         // Title
-        display.setFont(&FreeSans9pt7b);
+        cfFrame.setFont(&FreeSans9pt7b);
         const char* title = "CrispFace v" CRISPFACE_VERSION;
-        display.getTextBounds(title, 0, 0, &tx, &ty, &tw, &th);
-        display.setCursor((200 - (int)tw) / 2, 40);
-        display.print(title);
+        cfFrame.getTextBounds(title, 0, 0, &tx, &ty, &tw, &th);
+        cfFrame.setCursor((200 - (int)tw) / 2, 40);
+        cfFrame.print(title);
 
         // Time
-        display.setFont(&FreeSans24pt7b);
-        char tbuf[6];
+        cfFrame.setFont(&FreeSans24pt7b);
+        char tbuf[8];
         snprintf(tbuf, sizeof(tbuf), "%02d:%02d",
                  currentTime.Hour, currentTime.Minute);
-        display.getTextBounds(tbuf, 0, 0, &tx, &ty, &tw, &th);
-        display.setCursor((200 - (int)tw) / 2, 110);
-        display.print(tbuf);
+        cfFrame.getTextBounds(tbuf, 0, 0, &tx, &ty, &tw, &th);
+        cfFrame.setCursor((200 - (int)tw) / 2, 110);
+        cfFrame.print(tbuf);
 
         // Instructions
-        display.setFont(&FreeSans9pt7b);
+        cfFrame.setFont(&FreeSans9pt7b);
         const char* l1 = "No faces cached";
         const char* l2 = "Press top-left to sync";
-        display.getTextBounds(l1, 0, 0, &tx, &ty, &tw, &th);
-        display.setCursor((200 - (int)tw) / 2, 155);
-        display.print(l1);
-        display.getTextBounds(l2, 0, 0, &tx, &ty, &tw, &th);
-        display.setCursor((200 - (int)tw) / 2, 180);
-        display.print(l2);
+        cfFrame.getTextBounds(l1, 0, 0, &tx, &ty, &tw, &th);
+        cfFrame.setCursor((200 - (int)tw) / 2, 155);
+        cfFrame.print(l1);
+        cfFrame.getTextBounds(l2, 0, 0, &tx, &ty, &tw, &th);
+        cfFrame.setCursor((200 - (int)tw) / 2, 180);
+        cfFrame.print(l2);
     }
 };
 
@@ -1,16 +1,25 @@
 #!/usr/bin/env python3
 """Convert a BDF bitmap font to an Adafruit GFX .h header.
 
-Usage: python3 bdf2gfx.py <input.bdf> <font_name> [--scale N]
-
-Outputs a complete GFX font header (bitmaps, glyphs, font struct)
-for ASCII 0x20..0x7E. With --scale N, each pixel becomes NxN block.
+Usage: python3 bdf2gfx.py <input.bdf> <font_name> [--scale N [--base NAME]] [--oblique]
+
+Outputs a complete GFX font header (bitmaps, glyphs, font struct,
+GFXMetrics table) for ASCII 0x20..0x7E. Glyphs are always stored at the
+BDF's own resolution. With --scale N the font struct and GFXMetrics are
+N times larger and the renderer expands each pixel to an NxN block;
+--base NAME reuses the bitmaps and glyphs of the 1x header NAME (made
+from the same BDF) instead of emitting a copy. --oblique emits
+<font_name>Oblique instead, the sheared stale-text variant at its drawn
+size (see gfxoblique.py).
 """
 
 import sys
 import argparse
 import os
 
+from gfxmetrics import format_metrics
+from gfxoblique import oblique_header
+
 
 def parse_bdf(path):
     """Parse a BDF file, return (global props, list of glyph dicts)."""
@@ -68,17 +77,14 @@ def parse_bdf(path):
     return props, glyphs
 
 
-def glyph_to_bits(glyph, scale=1):
+def glyph_to_bits(glyph):
     """Convert glyph bitmap to packed bit array, return (bits, width, height).
 
     Each hex row in BDF is left-aligned in the byte boundary.
     We extract exactly bbw pixels from each row.
-    With scale > 1, each pixel becomes scale x scale.
     """
     bbw = glyph['bbw']
     bbh = glyph['bbh']
-    w = bbw * scale
-    h = bbh * scale
 
     if bbw == 0 or bbh == 0:
         return [], 0, 0
@@ -95,22 +101,13 @@ def glyph_to_bits(glyph, scale=1):
             pixel_row.append(bit)
         rows.append(pixel_row)
 
-    # Scale
-    scaled_rows = []
-    for row in rows:
-        scaled_row = []
-        for pixel in row:
-            scaled_row.extend([pixel] * scale)
-        for _ in range(scale):
-            scaled_rows.append(list(scaled_row))
-
     # Pack into bytes (MSB first, row by row)
     bits = []
-    for row in scaled_rows:
+    for row in rows:
         for pixel in row:
             bits.append(pixel)
 
-    return bits, w, h
+    return bits, bbw, bbh
 
 
 def pack_bits(bits):
@@ -125,10 +122,15 @@ def pack_bits(bits):
     return result
 
 
-def generate_header(font_name, props, glyphs, scale=1, first=0x20, last=0x7E):
-    """Generate the complete Adafruit GFX .h header."""
-    ascent = props.get('ascent', 0) * scale
-    descent = props.get('descent', 0) * scale
+def generate_header(font_name, props, glyphs, scale=1, base=None, first=0x20, last=0x7E):
+    """Generate the complete Adafruit GFX .h header.
+
+    Glyph entries stay at base resolution; only yAdvance and the
+    GFXMetrics table are scaled. With base set, the header points at
+    <base>Bitmaps / <base>Glyphs instead of emitting its own.
+    """
+    ascent = props.get('ascent', 0)
+    descent = props.get('descent', 0)
     y_advance = (ascent + descent)
 
     # Filter and sort glyphs for our range
@@ -148,7 +150,7 @@ def generate_header(font_name, props, glyphs, scale=1, first=0x20, last=0x7E):
 
         if g is None or g['bbw'] == 0 or g['bbh'] == 0:
             # Space or missing glyph
-            x_advance = (g['dwidth'] * scale) if g else (ascent // 2)
+            x_advance = g['dwidth'] if g else (ascent // 2)
             glyph_entries.append({
                 'offset': offset,
                 'width': 0,
@@ -159,18 +161,16 @@ def generate_header(font_name, props, glyphs, scale=1, first=0x20, last=0x7E):
             })
             continue
 
-        bits, w, h = glyph_to_bits(g, scale)
+        bits, w, h = glyph_to_bits(g)
         packed = pack_bits(bits)
         all_bitmap_bytes.extend(packed)
 
-        x_advance = g['dwidth'] * scale
-        x_offset = g['bbx'] * scale
+        x_advance = g['dwidth']
+        x_offset = g['bbx']
         # GFX yOffset: negative means above baseline
         # BDF bby is offset from baseline (positive = above baseline origin)
-        # GFX yOffset = -(bby + bbh) * scale ... relative to baseline at y=0
-        # Actually: GFX yOffset = -((bby + bbh) * scale) would put top of glyph
         # GFX convention: yOffset is from cursor baseline, negative = above
-        y_offset = -(g['bby'] + g['bbh']) * scale
+        y_offset = -(g['bby'] + g['bbh'])
 
         glyph_entries.append({
             'offset': offset,
@@ -188,36 +188,49 @@ def generate_header(font_name, props, glyphs, scale=1, first=0x20, last=0x7E):
     lines.append(f'#define {guard}')
     lines.append('')
     lines.append('#include <Adafruit_GFX.h>')
+    lines.append('#include "GFXMetrics.h"')
+    if base:
+        lines.append(f'#include "{base}.h"')
     lines.append('')
 
-    # Bitmaps array
-    lines.append(f'const uint8_t {font_name}Bitmaps[] PROGMEM = {{')
-    for i in range(0, len(all_bitmap_bytes), 12):
-        chunk = all_bitmap_bytes[i:i+12]
-        hex_str = ', '.join(f'0x{b:02X}' for b in chunk)
-        lines.append(f'  {hex_str},')
+    data_name = base or font_name
+    if not base:
+        # Bitmaps array
+        lines.append(f'const uint8_t {font_name}Bitmaps[] PROGMEM = {{')
+        for i in range(0, len(all_bitmap_bytes), 12):
+            chunk = all_bitmap_bytes[i:i+12]
+            hex_str = ', '.join(f'0x{b:02X}' for b in chunk)
+            lines.append(f'  {hex_str},')
+        lines.append('};')
+        lines.append('')
+
+        # Glyphs array
+        lines.append(f'const GFXglyph {font_name}Glyphs[] PROGMEM = {{')
+        for i, entry in enumerate(glyph_entries):
+            code = first + i
+            ch = chr(code) if 0x21 <= code <= 0x7E else ' '
+            lines.append(
+                f'  {{ {entry["offset"]:5d}, {entry["width"]:3d}, {entry["height"]:3d}, '
+                f'{entry["xAdvance"]:3d}, {entry["xOffset"]:4d}, {entry["yOffset"]:4d} }},'
+                f'  // 0x{code:02X} \'{ch}\''
+            )
+        lines.append('};')
+        lines.append('')
+
+    # Font struct (glyphs at base resolution, line advance at full size)
+    if scale > 1:
+        lines.append(f'// {scale}x: drawn by expanding each glyph pixel to {scale}x{scale}')
+    lines.append(f'const GFXfont {font_name} PROGMEM = {{')
+    lines.append(f'  (uint8_t  *){data_name}Bitmaps,')
+    lines.append(f'  (GFXglyph *){data_name}Glyphs,')
+    lines.append(f'  0x{first:02X}, 0x{last:02X}, {y_advance * scale}')
     lines.append('};')
     lines.append('')
 
-    # Glyphs array
-    lines.append(f'const GFXglyph {font_name}Glyphs[] PROGMEM = {{')
-    for i, entry in enumerate(glyph_entries):
-        code = first + i
-        ch = chr(code) if 0x21 <= code <= 0x7E else ' '
-        lines.append(
-            f'  {{ {entry["offset"]:5d}, {entry["width"]:3d}, {entry["height"]:3d}, '
-            f'{entry["xAdvance"]:3d}, {entry["xOffset"]:4d}, {entry["yOffset"]:4d} }},'
-            f'  // 0x{code:02X} \'{ch}\''
-        )
-    lines.append('};')
-    lines.append('')
-
-    # Font struct
-    lines.append(f'const GFXfont {font_name} PROGMEM = {{')
-    lines.append(f'  (uint8_t  *){font_name}Bitmaps,')
-    lines.append(f'  (GFXglyph *){font_name}Glyphs,')
-    lines.append(f'  0x{first:02X}, 0x{last:02X}, {y_advance}')
-    lines.append('};')
+    # Layout metrics, at the drawn size
+    scaled = [{k: (v * scale if k != 'offset' else v) for k, v in e.items()}
+              for e in glyph_entries]
+    lines.extend(format_metrics(font_name, scaled, first, last, y_advance * scale, scale))
     lines.append('')
     lines.append(f'#endif // {guard}')
     lines.append('')
@@ -230,11 +243,16 @@ def main():
     parser.add_argument('input', help='Input BDF file')
     parser.add_argument('font_name', help='C identifier for the font')
     parser.add_argument('--scale', type=int, default=1, help='Integer scale factor (default: 1)')
+    parser.add_argument('--base', help='1x font header to share glyph data with')
+    parser.add_argument('--oblique', action='store_true', help='Emit the sheared <font_name>Oblique variant')
     parser.add_argument('-o', '--output', help='Output file (default: stdout)')
     args = parser.parse_args()
 
     props, glyphs = parse_bdf(args.input)
-    header = generate_header(args.font_name, props, glyphs, scale=args.scale)
+    if args.oblique:
+        header = oblique_header(generate_header(args.font_name, props, glyphs, scale=args.scale))
+    else:
+        header = generate_header(args.font_name, props, glyphs, scale=args.scale, base=args.base)
 
     if args.output:
         with open(args.output, 'w') as f:
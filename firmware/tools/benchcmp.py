@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""Compare two native render benchmark runs (native/bench.cpp JSON).
+
+Usage: python3 benchcmp.py <before.json> <after.json> [--threshold PCT] [--all]
+
+Lists the cases whose time moved by more than the threshold (default 5%),
+or whose drawPixel() calls, changed frame bytes or peak JSON arena bytes
+differ at all (a pixel change means the output changed, not just the
+speed), then the geometric mean time ratio per function. --all lists
+every case.
+"""
+
+import sys
+import json
+import math
+import argparse
+
+
+def load(path):
+    with open(path) as f:
+        return {r['name']: r for r in json.load(f)['results']}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare two render benchmark runs')
+    parser.add_argument('before')
+    parser.add_argument('after')
+    parser.add_argument('--threshold', type=float, default=5.0, help='Time change to report, in percent')
+    parser.add_argument('--all', action='store_true', help='List every case')
+    args = parser.parse_args()
+
+    before, after = load(args.before), load(args.after)
+    common = [n for n in before if n in after]
+    for name in sorted(set(before) ^ set(after)):
+        print(f'{name}: only in {"before" if name in before else "after"}')
+
+    groups = {}
+    print(f'{"case":<48} {"before ns":>10} {"after ns":>10} {"change":>8}  pixels  bytes  json')
+    for name in common:
+        b, a = before[name], after[name]
+        ratio = a['ns'] / b['ns'] if b['ns'] > 0 else 1.0
+        groups.setdefault(name.split('/')[0], []).append(ratio)
+        moved = abs(ratio - 1) * 100 > args.threshold
+        px = '' if a['pixels'] == b['pixels'] else f'{b["pixels"]}->{a["pixels"]}'
+        by = '' if a['bytes'] == b['bytes'] else f'{b["bytes"]}->{a["bytes"]}'
+        js = '' if a.get('json', 0) == b.get('json', 0) else f'{b.get("json", 0)}->{a.get("json", 0)}'
+        if args.all or moved or px or by or js:
+            print(f'{name:<48} {b["ns"]:>10.0f} {a["ns"]:>10.0f} {(ratio - 1) * 100:>+7.1f}%  {px:<6}  {by:<5}  {js}')
+
+    print()
+    for func, ratios in groups.items():
+        gmean = math.exp(sum(math.log(r) for r in ratios) / len(ratios))
+        print(f'{func:<20} {len(ratios):4d} cases  {(gmean - 1) * 100:+6.1f}% (geometric mean)')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
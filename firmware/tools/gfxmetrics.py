@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""Emit a constexpr GFXMetrics table for an Adafruit GFX font header.
+
+Usage: python3 gfxmetrics.py <font.h> [--append] [-o output]
+
+Reads the glyph table and font struct from a fontconvert (or bdf2gfx)
+header and writes <name>Advance[] plus <name>Metrics (see
+include/crispface_fonts/GFXMetrics.h). With --append the table is added
+to the end of the input header itself.
+"""
+
+import sys
+import re
+import argparse
+
+GLYPH_RE = re.compile(
+    r'\{\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*\}')
+FONT_RE = re.compile(
+    r'const\s+GFXfont\s+(\w+)\s+PROGMEM\s*=\s*\{[^}]*?'
+    r'(0x[0-9A-Fa-f]+|\d+)\s*,\s*(0x[0-9A-Fa-f]+|\d+)\s*,\s*(\d+)\s*\}', re.S)
+
+
+def parse_header(text):
+    """Return (font_name, first, last, y_advance, glyphs) from header text.
+
+    Each glyph is a dict with offset, width, height, xAdvance, xOffset,
+    yOffset.
+    """
+    m = FONT_RE.search(text)
+    if not m:
+        raise ValueError('no GFXfont struct found')
+    name = m.group(1)
+    first = int(m.group(2), 0)
+    last = int(m.group(3), 0)
+    y_advance = int(m.group(4))
+    # Scaled Tamzen sizes point at their base font's table
+    g = re.search(r'\(GFXglyph\s*\*\)\s*(\w+)', m.group(0))
+    table = g.group(1) if g else f'{name}Glyphs'
+
+    start = text.find(f'{table}[]')
+    end = text.find('};', start)
+    if start < 0 or end < 0:
+        raise ValueError(f'no {table} table found')
+    glyphs = []
+    for g in GLYPH_RE.finditer(text, start, end):
+        off, w, h, xa, xo, yo = (int(v) for v in g.groups())
+        glyphs.append({'offset': off, 'width': w, 'height': h, 'xAdvance': xa,
+                       'xOffset': xo, 'yOffset': yo})
+    if len(glyphs) != last - first + 1:
+        raise ValueError(f'{name}: expected {last - first + 1} glyphs, found {len(glyphs)}')
+    return name, first, last, y_advance, glyphs
+
+
+def line_box(glyphs, first):
+    """Ascent and descent of 'A' and 'y', as getTextBounds("Ay") reports."""
+    miny, maxy = None, -1
+    for ch in 'Ay':
+        g = glyphs[ord(ch) - first]
+        if g['height'] == 0:
+            continue
+        y1 = g['yOffset']
+        y2 = y1 + g['height'] - 1
+        miny = y1 if miny is None else min(miny, y1)
+        maxy = max(maxy, y2)
+    if miny is None:
+        return 0, 0
+    return -miny, maxy + 1
+
+
+def format_metrics(font_name, glyphs, first, last, y_advance, scale=1, box=None):
+    """Return the C++ lines for <font_name>Advance and <font_name>Metrics.
+
+    glyphs are at the drawn size; scale is the factor the renderer
+    expands the stored bitmaps by. box overrides the (ascent, descent)
+    measured from 'A' and 'y', for subsets that may lack them.
+    """
+    ascent, descent = box or line_box(glyphs, first)
+    lines = []
+    lines.append(f'constexpr uint8_t {font_name}Advance[] = {{')
+    advances = [g['xAdvance'] for g in glyphs]
+    for i in range(0, len(advances), 16):
+        chunk = advances[i:i+16]
+        lines.append('  ' + ', '.join(f'{a:3d}' for a in chunk) + ',')
+    lines.append('};')
+    lines.append('')
+    lines.append(f'constexpr GFXMetrics {font_name}Metrics = {{')
+    lines.append(f'  {ascent}, {descent}, {y_advance}, {scale}, 0x{first:02X}, 0x{last:02X}, {font_name}Advance')
+    lines.append('};')
+    return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Emit GFXMetrics for a GFX font header')
+    parser.add_argument('input', help='GFX font header (.h)')
+    parser.add_argument('--append', action='store_true', help='Append the table to the input header')
+    parser.add_argument('-o', '--output', help='Output file (default: stdout)')
+    args = parser.parse_args()
+
+    with open(args.input) as f:
+        text = f.read()
+    name, first, last, y_advance, glyphs = parse_header(text)
+    if f'{name}Metrics' in text:
+        print(f'{args.input} already has {name}Metrics', file=sys.stderr)
+        return
+
+    block = ['', '#include "GFXMetrics.h"', '']
+    block += format_metrics(name, glyphs, first, last, y_advance)
+    block = '\n'.join(block) + '\n'
+
+    if args.append:
+        with open(args.input, 'a') as f:
+            f.write(block)
+        print(f'Appended {name}Metrics to {args.input}')
+    elif args.output:
+        with open(args.output, 'w') as f:
+            f.write(block)
+        print(f'Wrote {args.output}')
+    else:
+        sys.stdout.write(block)
+
+
+if __name__ == '__main__':
+    main()
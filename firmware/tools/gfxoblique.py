@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""Emit a sheared (oblique) copy of a GFX font header for stale text.
+
+Usage: python3 gfxoblique.py <font.h> [-o output]
+
+Writes <name>Oblique: every glyph row is shifted right by
+(height - row) * skew / height, the shear the firmware's skewed blit
+applied to stale complications, with skew = (ascent + descent + 2) / 5
+(at least 1) from the font's 'A'/'y' line box. Glyphs grow by skew
+pixels; offsets and advances are unchanged, so layout matches the
+upright font. Fonts with a GFXMetrics scale (the 2x/3x/4x Tamzen sizes)
+are expanded to their drawn size first, and a header that points at a
+base font's tables reads them from the #included base header.
+"""
+
+import os
+import re
+import sys
+import argparse
+
+from gfxmetrics import parse_header, line_box
+
+BITMAP_RE = r'const\s+uint8_t\s+{}\[\]\s+PROGMEM\s*=\s*\{{(.*?)\}};'
+SCALE_RE = r'GFXMetrics\s+{}Metrics\s*=\s*\{{\s*\d+\s*,\s*\d+\s*,\s*\d+\s*,\s*(\d+)\s*,'
+
+
+def oblique_skew(glyphs, first):
+    ascent, descent = line_box(glyphs, first)
+    return max(1, (ascent + descent + 2) // 5)
+
+
+def glyph_rows(bitmap, g):
+    """The glyph's pixels as a list of rows of 0/1."""
+    rows = []
+    bit = g['offset'] * 8
+    for _ in range(g['height']):
+        row = []
+        for _ in range(g['width']):
+            row.append((bitmap[bit >> 3] >> (7 - (bit & 7))) & 1)
+            bit += 1
+        rows.append(row)
+    return rows
+
+
+def oblique_header(text, base_dir='.'):
+    """Return the <name>Oblique header text for a GFX font header."""
+    # Pull in the base font's tables for headers that only point at them
+    # (appended, so the font's own struct is still the first one found)
+    for inc in re.findall(r'#include\s+"(\w+)\.h"', text):
+        path = os.path.join(base_dir, inc + '.h')
+        if inc != 'GFXMetrics' and os.path.exists(path):
+            with open(path) as f:
+                text = text + f.read()
+    name, first, last, y_advance, glyphs = parse_header(text)
+    m = re.search(r'const\s+GFXfont\s+' + name + r'\s+PROGMEM\s*=\s*\{\s*\(uint8_t\s*\*\)\s*(\w+)', text)
+    m = re.search(BITMAP_RE.format(m.group(1)), text, re.S)
+    if not m:
+        raise ValueError(f'no bitmap table found for {name}')
+    bitmap = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', m.group(1))]
+    m = re.search(SCALE_RE.format(name), text)
+    s = int(m.group(1)) if m else 1
+
+    # Drawn size
+    big = []
+    for g in glyphs:
+        rows = [[p for p in row for _ in range(s)] for row in glyph_rows(bitmap, g) for _ in range(s)]
+        big.append(dict(g, width=g['width'] * s, height=g['height'] * s,
+                        xAdvance=g['xAdvance'] * s, xOffset=g['xOffset'] * s,
+                        yOffset=g['yOffset'] * s, rows=rows))
+    skew = oblique_skew(big, first)
+
+    out_name = name + 'Oblique'
+    out_bitmap = []
+    out_glyphs = []
+    for g in big:
+        gw, gh = g['width'], g['height']
+        entry = dict(g, offset=len(out_bitmap))
+        if gw == 0 or gh == 0:
+            out_glyphs.append(entry)
+            continue
+        w = gw + skew
+        bits = []
+        for r, row in enumerate(g['rows']):
+            shift = (gh - r) * skew // gh
+            line = [0] * w
+            for c, p in enumerate(row):
+                line[c + shift] = p
+            bits.extend(line)
+        for i in range(0, len(bits), 8):
+            chunk = bits[i:i+8] + [0] * (8 - len(bits[i:i+8]))
+            out_bitmap.append(int(''.join(map(str, chunk)), 2))
+        entry['width'] = w
+        out_glyphs.append(entry)
+
+    guard = out_name.upper() + '_H'
+    lines = [f'#ifndef {guard}', f'#define {guard}', '',
+             f'// {name} sheared by up to {skew}px for stale text (tools/gfxoblique.py)', '',
+             '#include <Adafruit_GFX.h>', '']
+    lines.append(f'const uint8_t {out_name}Bitmaps[] PROGMEM = {{')
+    for i in range(0, len(out_bitmap), 12):
+        lines.append('  ' + ', '.join(f'0x{b:02X}' for b in out_bitmap[i:i+12]) + ',')
+    lines.append('};')
+    lines.append('')
+    lines.append(f'const GFXglyph {out_name}Glyphs[] PROGMEM = {{')
+    for i, g in enumerate(out_glyphs):
+        code = first + i
+        ch = chr(code) if 0x21 <= code <= 0x7E else ' '
+        lines.append(f'  {{ {g["offset"]:5d}, {g["width"]:3d}, {g["height"]:3d}, '
+                     f'{g["xAdvance"]:3d}, {g["xOffset"]:4d}, {g["yOffset"]:4d} }},'
+                     f'  // 0x{code:02X} \'{ch}\'')
+    lines.append('};')
+    lines.append('')
+    lines.append(f'const GFXfont {out_name} PROGMEM = {{')
+    lines.append(f'  (uint8_t  *){out_name}Bitmaps,')
+    lines.append(f'  (GFXglyph *){out_name}Glyphs,')
+    lines.append(f'  0x{first:02X}, 0x{last:02X}, {y_advance}')
+    lines.append('};')
+    lines.append('')
+    lines.append(f'#endif // {guard}')
+    lines.append('')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Emit an oblique copy of a GFX font header')
+    parser.add_argument('input', help='GFX font header (.h)')
+    parser.add_argument('-o', '--output', help='Output file (default: stdout)')
+    args = parser.parse_args()
+
+    with open(args.input) as f:
+        text = f.read()
+    try:
+        header = oblique_header(text, os.path.dirname(os.path.abspath(args.input)))
+    except ValueError as e:
+        print(f'{args.input}: {e}', file=sys.stderr)
+        sys.exit(1)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(header)
+        print(f'Wrote {args.output}')
+    else:
+        sys.stdout.write(header)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Cut a GFX font header (with its GFXMetrics table) down to a glyph set.
+
+Usage: python3 gfxsubset.py <font.h> --chars STRING [-o output]
+
+The font keeps its name, so a subset header is a drop-in replacement.
+first..last shrink to the lowest and highest kept codepoint; codepoints
+in between that are not kept get an empty glyph with zero advance, which
+the renderer skips. Bitmaps are kept only for the chosen glyphs. The
+line box (ascent/descent) is copied from the full font's metrics so
+layout does not change.
+"""
+
+import re
+import sys
+import argparse
+
+from gfxmetrics import parse_header, format_metrics
+
+BITMAP_RE = r'const\s+uint8_t\s+{}Bitmaps\[\]\s+PROGMEM\s*=\s*\{{(.*?)\}};'
+METRICS_RE = r'GFXMetrics\s+{}Metrics\s*=\s*\{{\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*,'
+
+
+def subset_header(text, chars):
+    """Return the header text for the glyphs in chars (a string)."""
+    name, first, last, y_advance, glyphs = parse_header(text)
+    m = re.search(BITMAP_RE.format(name), text, re.S)
+    if not m:
+        raise ValueError(f'no {name}Bitmaps table found')
+    bitmap = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', m.group(1))]
+    m = re.search(METRICS_RE.format(name), text)
+    if not m:
+        raise ValueError(f'{name} has no GFXMetrics table (run gfxmetrics.py first)')
+    ascent, descent, _, scale = (int(v) for v in m.groups())
+
+    keep = sorted({ord(c) for c in chars if first <= ord(c) <= last})
+    if not keep:
+        raise ValueError('no characters of the set are in the font')
+    sub_first, sub_last = keep[0], keep[-1]
+
+    out_bitmap = []
+    out_glyphs = []
+    for code in range(sub_first, sub_last + 1):
+        g = glyphs[code - first]
+        if code not in keep:
+            out_glyphs.append({'offset': 0, 'width': 0, 'height': 0,
+                               'xAdvance': 0, 'xOffset': 0, 'yOffset': 0})
+            continue
+        size = (g['width'] * g['height'] + 7) // 8
+        entry = dict(g, offset=len(out_bitmap))
+        out_bitmap.extend(bitmap[g['offset']:g['offset'] + size])
+        out_glyphs.append(entry)
+
+    shown = ''.join(chr(c) for c in keep)
+    lines = [f'// {name} subset ({len(keep)} glyphs): {shown}',
+             '// Generated by tools/gfxsubset.py', '']
+    lines.append(f'const uint8_t {name}Bitmaps[] PROGMEM = {{')
+    for i in range(0, len(out_bitmap), 12):
+        chunk = out_bitmap[i:i+12]
+        lines.append('  ' + ', '.join(f'0x{b:02X}' for b in chunk) + ',')
+    lines.append('};')
+    lines.append('')
+    lines.append(f'const GFXglyph {name}Glyphs[] PROGMEM = {{')
+    for i, g in enumerate(out_glyphs):
+        code = sub_first + i
+        mark = f"'{chr(code)}'" if code in keep and code != 0x20 else f'0x{code:02X}'
+        lines.append(f'  {{ {g["offset"]:5d}, {g["width"]:3d}, {g["height"]:3d}, '
+                     f'{g["xAdvance"]:3d}, {g["xOffset"]:4d}, {g["yOffset"]:4d} }}, // {mark}')
+    lines.append('};')
+    lines.append('')
+    lines.append(f'const GFXfont {name} PROGMEM = {{')
+    lines.append(f'  (uint8_t  *){name}Bitmaps,')
+    lines.append(f'  (GFXglyph *){name}Glyphs,')
+    lines.append(f'  0x{sub_first:02X}, 0x{sub_last:02X}, {y_advance} }};')
+    lines.append('')
+    lines.append('#include "GFXMetrics.h"')
+    lines.append('')
+    lines.extend(format_metrics(name, out_glyphs, sub_first, sub_last, y_advance,
+                                scale, box=(ascent, descent)))
+    lines.append('')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Subset a GFX font header')
+    parser.add_argument('input', help='GFX font header (.h) with a GFXMetrics table')
+    parser.add_argument('--chars', required=True, help='Characters to keep')
+    parser.add_argument('-o', '--output', help='Output file (default: stdout)')
+    args = parser.parse_args()
+
+    with open(args.input) as f:
+        text = f.read()
+    try:
+        header = subset_header(text, args.chars)
+    except ValueError as e:
+        print(f'{args.input}: {e}', file=sys.stderr)
+        sys.exit(1)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(header)
+        print(f'Wrote {args.output}')
+    else:
+        sys.stdout.write(header)
+
+
+if __name__ == '__main__':
+    main()
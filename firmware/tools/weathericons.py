@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+"""Pre-rasterise the weather icons into a 1bpp atlas header.
+
+Usage: python3 weathericons.py [-o include/crispface_icons/WeatherIcons.h]
+
+Draws every icon bucket of CrispFace::drawWeatherIcon() at each size the
+weather sources offer (the editor's iconsize options), with the same
+integer geometry and Adafruit_GFX line/circle algorithms as the firmware,
+so blitted icons match the drawn ones pixel for pixel. Each size becomes
+a GFXfont whose glyph N is bucket N, cropped to its set pixels and offset
+from the icon box's top-left corner. Keep this in step with the drawing
+code in src/main.cpp.
+"""
+
+import argparse
+
+SIZES = [16, 24, 32, 48, 64, 96]
+
+# Met Office code buckets, in drawWeatherIcon() order
+BUCKETS = ['Sun', 'PartCloud', 'Fog', 'Cloud', 'LightRain', 'HeavyRain', 'Snow', 'Thunder']
+
+
+def cdiv(a, b):
+    """C integer division (truncates toward zero)."""
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
+
+
+class Canvas:
+    """Set of lit pixels, drawn with Adafruit_GFX's algorithms."""
+
+    def __init__(self):
+        self.px = set()
+
+    def pixel(self, x, y):
+        self.px.add((x, y))
+
+    def write_line(self, x0, y0, x1, y1):
+        steep = abs(y1 - y0) > abs(x1 - x0)
+        if steep:
+            x0, y0, x1, y1 = y0, x0, y1, x1
+        if x0 > x1:
+            x0, x1, y0, y1 = x1, x0, y1, y0
+        dx, dy = x1 - x0, abs(y1 - y0)
+        err = dx // 2
+        ystep = 1 if y0 < y1 else -1
+        while x0 <= x1:
+            if steep:
+                self.pixel(y0, x0)
+            else:
+                self.pixel(x0, y0)
+            err -= dy
+            if err < 0:
+                y0 += ystep
+                err += dx
+            x0 += 1
+
+    def vline(self, x, y, h):
+        self.write_line(x, y, x, y + h - 1)
+
+    def line(self, x0, y0, x1, y1):
+        self.write_line(x0, y0, x1, y1)
+
+    def fill_rect(self, x, y, w, h):
+        for i in range(x, x + w):
+            self.vline(i, y, h)
+
+    def fill_circle(self, x0, y0, r):
+        self.vline(x0, y0 - r, 2 * r + 1)
+        f, ddx, ddy, x, y = 1 - r, 1, -2 * r, 0, r
+        px, py = x, y
+        delta = 1
+        while x < y:
+            if f >= 0:
+                y -= 1
+                ddy += 2
+                f += ddy
+            x += 1
+            ddx += 2
+            f += ddx
+            if x < y + 1:
+                self.vline(x0 + x, y0 - y, 2 * y + delta)
+                self.vline(x0 - x, y0 - y, 2 * y + delta)
+            if y != py:
+                self.vline(x0 + py, y0 - px, 2 * px + delta)
+                self.vline(x0 - py, y0 - px, 2 * px + delta)
+                py = y
+            px = x
+
+
+# ---- Geometry, as in src/main.cpp ----
+
+def cloud(c, cx, cy, s):
+    r1 = cdiv(s * 3, 10)
+    r2 = cdiv(s, 4)
+    base_h = cdiv(s, 5)
+    base_w = cdiv(s * 3, 4)
+    base_y = cy + cdiv(r2, 2)
+    c.fill_rect(cx - cdiv(base_w, 2), base_y, base_w, base_h)
+    c.fill_circle(cx - cdiv(base_w, 4), base_y, r2)
+    c.fill_circle(cx, base_y - cdiv(r1, 3), r1)
+    c.fill_circle(cx + cdiv(base_w, 4), base_y, r2 - 1)
+
+
+def sun(c, cx, cy, s):
+    r = cdiv(s, 5)
+    c.fill_circle(cx, cy, r)
+    dx = [10, 7, 0, -7, -10, -7, 0, 7]
+    dy = [0, -7, -10, -7, 0, 7, 10, 7]
+    inner, outer = r + 2, r * 2
+    for i in range(8):
+        c.line(cx + cdiv(dx[i] * inner, 10), cy + cdiv(dy[i] * inner, 10),
+               cx + cdiv(dx[i] * outer, 10), cy + cdiv(dy[i] * outer, 10))
+
+
+def part_cloud(c, cx, cy, s):
+    sun(c, cx + cdiv(s, 5), cy - cdiv(s, 5), cdiv(s * 2, 3))
+    cloud(c, cx - cdiv(s, 8), cy + cdiv(s, 8), cdiv(s * 3, 4))
+
+
+def fog(c, x, y, w, h):
+    line_h = cdiv(h, 6)
+    pad = cdiv(w, 8)
+    for i in range(1, 5):
+        ly = y + cdiv(i * h, 5)
+        lx = x + pad + (cdiv(pad, 2) if i % 2 == 0 else 0)
+        lw = w - pad * 2 - (cdiv(pad, 2) if i % 2 == 0 else 0)
+        c.line(lx, ly, lx + lw, ly)
+        if line_h > 1:
+            c.line(lx, ly + 1, lx + lw, ly + 1)
+
+
+def rain(c, cx, cy, s, count):
+    drop_h = cdiv(s, 6)
+    spacing = cdiv(s, count + 1)
+    start_x = cx - cdiv((count - 1) * spacing, 2)
+    for i in range(count):
+        dx = start_x + i * spacing
+        c.line(dx, cy, dx - 1, cy + drop_h)
+        c.line(dx + 1, cy, dx, cy + drop_h)
+
+
+def snow(c, cx, cy, s):
+    spacing = cdiv(s, 4)
+    start_x = cx - spacing
+    for row in range(2):
+        dy = cy + row * spacing
+        offset = cdiv(row * spacing, 2)
+        for i in range(3 - row):
+            c.fill_circle(start_x + offset + i * spacing, dy, 1)
+
+
+def lightning(c, cx, cy, s):
+    bh = cdiv(s * 2, 5)
+    bw = cdiv(s, 6)
+    c.line(cx + bw, cy, cx - cdiv(bw, 2), cy + cdiv(bh, 2))
+    c.line(cx - cdiv(bw, 2), cy + cdiv(bh, 2), cx + cdiv(bw, 2), cy + cdiv(bh, 2))
+    c.line(cx + cdiv(bw, 2), cy + cdiv(bh, 2), cx - bw, cy + bh)
+    c.line(cx + bw + 1, cy, cx - cdiv(bw, 2) + 1, cy + cdiv(bh, 2))
+    c.line(cx + cdiv(bw, 2) + 1, cy + cdiv(bh, 2), cx - bw + 1, cy + bh)
+
+
+def draw_icon(bucket, s):
+    """Lit pixels of one bucket in an s x s box at the origin."""
+    c = Canvas()
+    cx, cy = cdiv(s, 2), cdiv(s, 2)
+    if bucket == 0:
+        sun(c, cx, cy, s)
+    elif bucket == 1:
+        part_cloud(c, cx, cy, s)
+    elif bucket == 2:
+        fog(c, 0, 0, s, s)
+    elif bucket == 3:
+        cloud(c, cx, cy - cdiv(s, 8), s)
+    else:
+        cloud(c, cx, cy - cdiv(s, 4), s)
+        if bucket == 4:
+            rain(c, cx, cy + cdiv(s, 5), s, 3)
+        elif bucket == 5:
+            rain(c, cx, cy + cdiv(s, 5), s, 5)
+        elif bucket == 6:
+            snow(c, cx, cy + cdiv(s, 5), s)
+        else:
+            lightning(c, cx, cy + cdiv(s, 6), s)
+    return c.px
+
+
+def glyph_bits(px):
+    """Crop to the lit pixels: (bytes, width, height, xOffset, yOffset)."""
+    xs = [p[0] for p in px]
+    ys = [p[1] for p in px]
+    x0, y0 = min(xs), min(ys)
+    w, h = max(xs) - x0 + 1, max(ys) - y0 + 1
+    out, acc, n = [], 0, 0
+    for y in range(y0, y0 + h):
+        for x in range(x0, x0 + w):
+            acc = (acc << 1) | ((x, y) in px)
+            n += 1
+            if n == 8:
+                out.append(acc)
+                acc, n = 0, 0
+    if n:
+        out.append(acc << (8 - n))
+    return out, w, h, x0, y0
+
+
+def generate():
+    lines = ['#ifndef WEATHERICONS_H', '#define WEATHERICONS_H', '',
+             '// Generated by tools/weathericons.py: one GFXfont per icon size,',
+             '// glyph N = drawWeatherIcon() bucket N, offsets from the box top-left',
+             '', '#include <Adafruit_GFX.h>', '']
+    total = 0
+    for s in SIZES:
+        name = f'WeatherIcons{s}'
+        bitmap, glyphs = [], []
+        for b in range(len(BUCKETS)):
+            data, w, h, xo, yo = glyph_bits(draw_icon(b, s))
+            glyphs.append((len(bitmap), w, h, s, xo, yo))
+            bitmap.extend(data)
+        total += len(bitmap) + 7 * len(glyphs)
+        lines.append(f'const uint8_t {name}Bitmaps[] PROGMEM = {{')
+        for i in range(0, len(bitmap), 12):
+            lines.append('  ' + ', '.join(f'0x{v:02X}' for v in bitmap[i:i+12]) + ',')
+        lines.append('};')
+        lines.append('')
+        lines.append(f'const GFXglyph {name}Glyphs[] PROGMEM = {{')
+        for b, g in enumerate(glyphs):
+            lines.append(f'  {{ {g[0]:5d}, {g[1]:3d}, {g[2]:3d}, {g[3]:3d}, {g[4]:4d}, {g[5]:4d} }},  // {BUCKETS[b]}')
+        lines.append('};')
+        lines.append('')
+        lines.append(f'const GFXfont {name} PROGMEM = {{')
+        lines.append(f'  (uint8_t  *){name}Bitmaps,')
+        lines.append(f'  (GFXglyph *){name}Glyphs,')
+        lines.append(f'  0, {len(BUCKETS) - 1}, {s}')
+        lines.append('};')
+        lines.append('')
+    lines.append('// Atlas sizes; yAdvance holds the icon size')
+    lines.append('const GFXfont* const WeatherIconSets[] = {')
+    lines.append('  ' + ', '.join(f'&WeatherIcons{s}' for s in SIZES) + ',')
+    lines.append('};')
+    lines.append('')
+    lines.append('#endif // WEATHERICONS_H')
+    lines.append('')
+    return '\n'.join(lines), total
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Rasterise weather icons into a GFX atlas header')
+    parser.add_argument('-o', '--output', help='Output file (default: stdout)')
+    args = parser.parse_args()
+
+    header, total = generate()
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(header)
+        print(f'Wrote {args.output} ({total} bytes of icon data)')
+    else:
+        print(header)
+
+
+if __name__ == '__main__':
+    main()
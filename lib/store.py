@@ -480,6 +480,10 @@ def delete_watch(watch_id, user):
     if not path or not os.path.exists(path):
         return False
     os.remove(path)
+    # Values last synced to it (watch_faces.py)
+    sync_path = path[:-len('.json')] + '.sync'
+    if os.path.exists(sync_path):
+        os.remove(sync_path)
     return True
 
 